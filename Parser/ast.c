@@ -0,0 +1,104 @@
+/* Project:  COCKTAIL training
+ * Descr:    A recursive Decent Parser for expressions
+ * Kind:     Arena of abstract syntax trees
+ *
+ * The nodes live in one array and refer to each other by index, so a tree
+ * is a contiguous block of 12 byte records which is freed by resetting the
+ * node count. The parser builds the trees bottom up on a stack of nodes.
+ */
+
+# include "expr_scan.h"
+# include "DynArray.h"
+# include "ast.h"
+
+# define INIT_SIZE	256
+
+tNodeRec *	     AstNodes = NULL;
+tNode		     AstCount = 0;
+static unsigned long node_size = 0;
+
+static tNode *	     stack = NULL;
+static unsigned long stack_size = 0;
+static unsigned long depth = 0;
+
+static tNode NewNode (int Op, tNode Left, tNode Right)
+{
+  if (AstNodes == NULL) {
+    node_size = INIT_SIZE;
+    MakeArray ((char * *) & AstNodes, & node_size, sizeof (tNodeRec));
+  } else if (AstCount + 1 == node_size) {	/* node 0 is NoNode */
+    ExtendArray ((char * *) & AstNodes, & node_size, sizeof (tNodeRec));
+  }
+  AstCount ++;
+  AstNodes [AstCount].Op    = (uint32_t) Op;
+  AstNodes [AstCount].Left  = Left;
+  AstNodes [AstCount].Right = Right;
+  return AstCount;
+}
+
+static tNode Push (tNode Node)
+{
+  if (stack == NULL) {
+    stack_size = INIT_SIZE;
+    MakeArray ((char * *) & stack, & stack_size, sizeof (tNode));
+  } else if (depth == stack_size) {
+    ExtendArray ((char * *) & stack, & stack_size, sizeof (tNode));
+  }
+  return stack [depth ++] = Node;
+}
+
+void ResetAst (void)
+{
+  AstCount = 0;
+  depth = 0;
+}
+
+void ReleaseAst (void)
+{
+  if (AstNodes != NULL) ReleaseArray ((char * *) & AstNodes, & node_size, sizeof (tNodeRec));
+  if (stack != NULL) ReleaseArray ((char * *) & stack, & stack_size, sizeof (tNode));
+  AstNodes = NULL;
+  stack = NULL;
+  ResetAst ();
+}
+
+tNode PushLeaf (tIdent Ident)
+{
+  return Push (NewNode (tok_identifier, (tNode) Ident, NoNode));
+}
+
+tNode PushBinary (int Op)
+{
+  tNode Right = stack [-- depth];
+  tNode Left  = stack [-- depth];
+  return Push (NewNode (Op, Left, Right));
+}
+
+tNode PushUnary (int Op)
+{
+  tNode Operand = stack [-- depth];
+  return Push (NewNode (Op, Operand, NoNode));
+}
+
+tNode TopNode (void)
+{
+  return depth == 0 ? NoNode : stack [depth - 1];
+}
+
+void WriteAst (FILE * File, tNode Node)
+{
+  if (Node == NoNode) return;
+  if (AstOp (Node) == tok_identifier) {
+    WriteIdent (File, AstIdent (Node));
+  } else if (AstRight (Node) == NoNode) {
+    fprintf (File, "(%c", (int) AstOp (Node));
+    WriteAst (File, AstLeft (Node));
+    fputc (')', File);
+  } else {
+    fputc ('(', File);
+    WriteAst (File, AstLeft (Node));
+    fprintf (File, " %c ", (int) AstOp (Node));
+    WriteAst (File, AstRight (Node));
+    fputc (')', File);
+  }
+}
@@ -0,0 +1,60 @@
+/* Project:  COCKTAIL training
+ * Descr:    A recursive Decent Parser for expressions
+ * Kind:     Arena of abstract syntax trees (interface)
+ */
+
+# ifndef ast_H
+# define ast_H
+
+# include <stdio.h>
+# include <stdint.h>
+# include "Idents.h"
+
+typedef uint32_t tNode;
+/* a node is the index of its record in the arena */
+
+# define NoNode 0
+
+typedef struct {
+  uint32_t Op;		/* '+', '*' or tok_identifier */
+  tNode    Left;	/* the operands of '+' and '*' */
+  tNode    Right;
+} tNodeRec;
+/* For an identifier `Left' holds its tIdent (see AstIdent), the operand of
+ * a prefix operator is `Left', its `Right' is NoNode.
+ */
+
+extern tNodeRec * AstNodes;
+/* the arena: the records of the nodes 1 .. AstCount */
+
+extern tNode AstCount;
+
+# define AstOp(n)	AstNodes [n].Op
+# define AstLeft(n)	AstNodes [n].Left
+# define AstRight(n)	AstNodes [n].Right
+# define AstIdent(n)	((tIdent) AstNodes [n].Left)
+
+extern void  ResetAst   (void);
+/* Frees all nodes at once, the memory is kept for the next tree. */
+
+extern void  ReleaseAst (void);
+/* Frees the memory of the arena. */
+
+extern tNode PushLeaf   (tIdent Ident);
+/* Creates an identifier node and pushes it onto the node stack. */
+
+extern tNode PushBinary (int Op);
+/* Pops the right and the left operand from the node stack and pushes
+ * the node `Left Op Right' created from them.
+ */
+
+extern tNode PushUnary  (int Op);
+/* Pops the operand from the node stack and pushes the node `Op Operand'. */
+
+extern tNode TopNode    (void);
+/* Returns the node on top of the node stack, NoNode if it is empty. */
+
+extern void  WriteAst   (FILE * File, tNode Node);
+/* Writes the tree `Node' fully parenthesized. */
+
+# endif
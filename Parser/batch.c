@@ -0,0 +1,85 @@
+/* Project:  COCKTAIL training
+ * Descr:    A recursive Decent Parser for expressions
+ * Kind:     Evaluation of compiled expressions over columns
+ *
+ * A register of the machine in vm.c becomes a column of BATCH_ROWS values.
+ * Loads do not copy: the register refers to the strip of the input column.
+ * The instruction computing the result writes into `Result' directly.
+ */
+
+# include <string.h>
+# include "DynArray.h"
+# include "batch.h"
+
+# ifdef __SSE2__
+# include <emmintrin.h>
+# endif
+
+static double *	     scratch = NULL;	/* BATCH_ROWS values per register */
+static unsigned long scratch_size = 0;
+
+static const double  zeros [BATCH_ROWS];
+
+static void Add (double * r, const double * a, const double * b, unsigned long n)
+{
+  unsigned long i = 0;
+# ifdef __SSE2__
+  for (; i + 4 <= n; i += 4) {
+    _mm_storeu_pd (r + i,     _mm_add_pd (_mm_loadu_pd (a + i),     _mm_loadu_pd (b + i)));
+    _mm_storeu_pd (r + i + 2, _mm_add_pd (_mm_loadu_pd (a + i + 2), _mm_loadu_pd (b + i + 2)));
+  }
+# endif
+  for (; i < n; i ++) r [i] = a [i] + b [i];
+}
+
+static void Mul (double * r, const double * a, const double * b, unsigned long n)
+{
+  unsigned long i = 0;
+# ifdef __SSE2__
+  for (; i + 4 <= n; i += 4) {
+    _mm_storeu_pd (r + i,     _mm_mul_pd (_mm_loadu_pd (a + i),     _mm_loadu_pd (b + i)));
+    _mm_storeu_pd (r + i + 2, _mm_mul_pd (_mm_loadu_pd (a + i + 2), _mm_loadu_pd (b + i + 2)));
+  }
+# endif
+  for (; i < n; i ++) r [i] = a [i] * b [i];
+}
+
+void EvaluateBatch (const tCode * Code, const double * const * Columns,
+		    double * Result, unsigned long Rows)
+{
+  const double * R [MAX_REGISTERS];
+  unsigned long	 needed = (unsigned long) Code->Registers * BATCH_ROWS;
+  unsigned long	 start, last, k;
+
+  if (scratch == NULL) {
+    scratch_size = needed > 0 ? needed : BATCH_ROWS;
+    MakeArray ((char * *) & scratch, & scratch_size, sizeof (double));
+  }
+  while (scratch_size < needed)
+    ExtendArray ((char * *) & scratch, & scratch_size, sizeof (double));
+
+  last = Code->Count - 2;	/* the instruction in front of ret computes the result */
+
+  for (start = 0; start < Rows; start += BATCH_ROWS) {
+    unsigned long n = Rows - start < BATCH_ROWS ? Rows - start : BATCH_ROWS;
+    for (k = 0; k < Code->Count; k ++) {
+      const tInstr * i = & Code->Instr [k];
+      double * out = k == last ? Result + start : scratch + i->Dst * BATCH_ROWS;
+      switch (i->Op) {
+      case OpLoad:
+	R [i->Dst] = Columns [i->Ident] != NULL ? Columns [i->Ident] + start : zeros;
+	if (k == last) memcpy (out, R [i->Dst], n * sizeof (double));
+	break;
+      case OpAdd: Add (out, R [i->A], R [i->B], n); R [i->Dst] = out; break;
+      case OpMul: Mul (out, R [i->A], R [i->B], n); R [i->Dst] = out; break;
+      case OpRet: break;
+      }
+    }
+  }
+}
+
+void ReleaseBatch (void)
+{
+  if (scratch != NULL) ReleaseArray ((char * *) & scratch, & scratch_size, sizeof (double));
+  scratch = NULL;
+}
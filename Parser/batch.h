@@ -0,0 +1,27 @@
+/* Project:  COCKTAIL training
+ * Descr:    A recursive Decent Parser for expressions
+ * Kind:     Evaluation of compiled expressions over columns (interface)
+ */
+
+# ifndef batch_H
+# define batch_H
+
+# include "vm.h"
+
+# define BATCH_ROWS	1024
+/* rows evaluated at once: the scratch columns of all registers stay in
+ * the cache
+ */
+
+extern void EvaluateBatch (const tCode * Code, const double * const * Columns,
+			   double * Result, unsigned long Rows);
+/* Evaluates `Code' for `Rows' rows: the value of identifier `i' in row `r'
+ * is `Columns [i][r]' (0, if `Columns [i]' is NULL), the value of the
+ * expression is stored in `Result [r]'. Every instruction is executed for
+ * a strip of BATCH_ROWS rows at once, using SSE2 if available.
+ */
+
+extern void ReleaseBatch  (void);
+/* Frees the scratch columns kept between calls of EvaluateBatch. */
+
+# endif
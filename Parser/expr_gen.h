@@ -0,0 +1,17 @@
+/* Project:  COCKTAIL training
+ * Descr:    A recursive Decent Parser for expressions
+ * Kind:     The parsers generated by llgen from expr.bnf (interface)
+ */
+
+# ifndef expr_gen_H
+# define expr_gen_H
+
+# include "parser.h"
+
+extern bool rd_E (void);
+/* Same as f_E(), generated by `llgen -r' (expr_rd.c). */
+
+extern bool table_E (void);
+/* Same as f_E(), generated by `llgen -t' (expr_table.c). */
+
+# endif
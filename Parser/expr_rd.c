@@ -0,0 +1,88 @@
+/* Recursive decent parser generated by llgen from expr.bnf, do not edit */
+
+# include <stdint.h>
+# include "expr_scan.h"
+# include "parser.h"
+# include "Errors.h"
+
+# define EOF_TOKEN expr_scan_EofToken
+
+static int llgen_terminal [256];	/* terminal + 1, 0: none */
+
+/* the token codes have to be in 0 .. 255 */
+typedef char llgen_check_0 [(unsigned) (EOF_TOKEN) < 256 ? 1 : -1];
+typedef char llgen_check_1 [(unsigned) (tok_identifier) < 256 ? 1 : -1];
+typedef char llgen_check_2 [(unsigned) ('+') < 256 ? 1 : -1];
+typedef char llgen_check_3 [(unsigned) ('*') < 256 ? 1 : -1];
+typedef char llgen_check_4 [(unsigned) ('(') < 256 ? 1 : -1];
+typedef char llgen_check_5 [(unsigned) (')') < 256 ? 1 : -1];
+
+static void llgen_init (void)
+{
+  llgen_terminal [EOF_TOKEN] = 1;	/* eof */
+  llgen_terminal [tok_identifier] = 2;	/* id */
+  llgen_terminal ['+'] = 3;	/* + */
+  llgen_terminal ['*'] = 4;	/* * */
+  llgen_terminal ['('] = 5;	/* ( */
+  llgen_terminal [')'] = 6;	/* ) */
+}
+
+# define TERMINAL(token) ((unsigned) (token) < 256 ? llgen_terminal [token] - 1 : -1)
+
+/* CurToken is element of `set' */
+# define IN(set) (TERMINAL (CurToken) >= 0 && ((UINT64_C (1) << TERMINAL (CurToken)) & UINT64_C (set)) != 0)
+
+static bool g_E1 (void);
+static bool g_T (void);
+static bool g_T1 (void);
+static bool g_F (void);
+
+bool rd_E (void)
+{
+  static bool initialized = false;
+  if (! initialized) { llgen_init (); initialized = true; }
+
+  /* E  ::= T E1 */
+  if (IN (0x0000000000000012)) return g_T () && g_E1 ();
+  Message ("Syntax Error in <E>", xxError, expr_scan_Attribute.Position);
+  return false; /* Syntax Error */
+}
+
+static bool g_E1 (void)
+{
+  /* E1 ::= + T E1 */
+  if (IN (0x0000000000000004)) return match ('+') && g_T () && g_E1 ();
+  /* E1 ::= epsilon */
+  if (IN (0x0000000000000021)) return true;
+  Message ("Syntax Error in <E1>", xxError, expr_scan_Attribute.Position);
+  return false; /* Syntax Error */
+}
+
+static bool g_T (void)
+{
+  /* T  ::= F T1 */
+  if (IN (0x0000000000000012)) return g_F () && g_T1 ();
+  Message ("Syntax Error in <T>", xxError, expr_scan_Attribute.Position);
+  return false; /* Syntax Error */
+}
+
+static bool g_T1 (void)
+{
+  /* T1 ::= * F T1 */
+  if (IN (0x0000000000000008)) return match ('*') && g_F () && g_T1 ();
+  /* T1 ::= epsilon */
+  if (IN (0x0000000000000025)) return true;
+  Message ("Syntax Error in <T1>", xxError, expr_scan_Attribute.Position);
+  return false; /* Syntax Error */
+}
+
+static bool g_F (void)
+{
+  /* F  ::= ( E ) */
+  if (IN (0x0000000000000010)) return match ('(') && rd_E () && match (')');
+  /* F  ::= id */
+  if (IN (0x0000000000000002)) return match (tok_identifier);
+  Message ("Syntax Error in <F>", xxError, expr_scan_Attribute.Position);
+  return false; /* Syntax Error */
+}
+
@@ -289,15 +289,11 @@ static void yyTab1	ARGS ((int yya));
 # define yyTab		yyTab1 (0)
 # define yyTab2(a,b)	yyTab1 (a)
 
-void expr_scan_ErrorAttribute
-# ifdef HAVE_ARGS
-   (int Token, expr_scan_tScanAttribute * Attribute)
-# else
-   (Token, Attribute)
-   int Token;
-   expr_scan_tScanAttribute * Attribute;
-# endif
-   { }
+/* line 29 "expr.rex" */
+
+void expr_scan_SetLine (unsigned int Line) { yyLineCount = Line; }
+
+/* line 296 "expr_scan.c" */
 
 # ifndef yySetPosition
 # define yySetPosition expr_scan_Attribute.Position.Line = yyLineCount; \
@@ -491,44 +487,44 @@ yyContinue:		/* continue after sentinel or skipping blanks */
 switch (* -- yyStatePtr) {
 case 3:;
 yySetPosition
-/* line 37 "expr.rex" */
+/* line 46 "expr.rex" */
 {expr_scan_Attribute.identifier.Value =
 			(char*) malloc (expr_scan_TokenLength + 1);
 	 expr_scan_GetWord (expr_scan_Attribute.identifier.Value);
 	 return tok_identifier;
 	
-/* line 501 "expr_scan.c" */
+/* line 496 "expr_scan.c" */
 } goto yyBegin;
 case 15:;
 yySetPosition
-/* line 43 "expr.rex" */
+/* line 52 "expr.rex" */
 {return '+';
-/* line 507 "expr_scan.c" */
+/* line 502 "expr_scan.c" */
 } goto yyBegin;
 case 14:;
 yySetPosition
-/* line 44 "expr.rex" */
+/* line 53 "expr.rex" */
 {return '*';
-/* line 513 "expr_scan.c" */
+/* line 508 "expr_scan.c" */
 } goto yyBegin;
 case 13:;
 yySetPosition
-/* line 45 "expr.rex" */
+/* line 54 "expr.rex" */
 {return '(';
-/* line 519 "expr_scan.c" */
+/* line 514 "expr_scan.c" */
 } goto yyBegin;
 case 12:;
 yySetPosition
-/* line 46 "expr.rex" */
+/* line 55 "expr.rex" */
 {return ')';
-/* line 525 "expr_scan.c" */
+/* line 520 "expr_scan.c" */
 } goto yyBegin;
 case 5:;
 yySetPosition
-/* line 49 "expr.rex" */
+/* line 58 "expr.rex" */
 { /* comment up to end of line, nothing to do */
         
-/* line 532 "expr_scan.c" */
+/* line 527 "expr_scan.c" */
 } goto yyBegin;
 case 11:;
 {/* BlankAction */
@@ -537,17 +533,17 @@ expr_scan_TokenPtr = (yytChar *) -- yyChBufferIndexReg;
 yyState = yyStartState;
 yyStatePtr = & yyStateStack [1];
 goto yyContinue;
-/* line 541 "expr_scan.c" */
+/* line 536 "expr_scan.c" */
 } goto yyBegin;
 case 10:;
 {/* TabAction */
 yyTab;
-/* line 546 "expr_scan.c" */
+/* line 541 "expr_scan.c" */
 } goto yyBegin;
 case 9:;
 {/* EolAction */
 yyEol (0);
-/* line 551 "expr_scan.c" */
+/* line 546 "expr_scan.c" */
 } goto yyBegin;
 case 1:;
 case 2:;
@@ -562,12 +558,12 @@ case 8:
       expr_scan_TokenLength   = 1;
 	 yyChBufferIndex = ++ yyChBufferIndexReg;
 	 {
-/* line 24 "expr.rex" */
+/* line 33 "expr.rex" */
 
   WritePosition (stderr, expr_scan_Attribute.Position);
   fprintf (stderr, " Illegal character [%c]\n", *expr_scan_TokenPtr);
 
-/* line 571 "expr_scan.c" */
+/* line 566 "expr_scan.c" */
 	 }
 	 goto yyBegin;
 
@@ -23,7 +23,12 @@ typedef union {
 
 # define tok_identifier 1
 
-/* line 27 "expr_scan.h" */
+extern void expr_scan_SetLine (unsigned int Line);
+/* Sets the line number of the current input, for an input which is part
+ * of a larger text: to be called after expr_scan_BeginMemoryN.
+ */
+
+/* line 32 "expr_scan.h" */
 
 # define expr_scan_EofToken	0
 # define expr_scan_xxMaxCharacter	255
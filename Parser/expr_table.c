@@ -0,0 +1,98 @@
+/* Table driven parser generated by llgen from expr.bnf, do not edit */
+
+# include <stdint.h>
+# include "expr_scan.h"
+# include "parser.h"
+# include "Errors.h"
+
+# define EOF_TOKEN expr_scan_EofToken
+
+static int llgen_terminal [256];	/* terminal + 1, 0: none */
+
+/* the token codes have to be in 0 .. 255 */
+typedef char llgen_check_0 [(unsigned) (EOF_TOKEN) < 256 ? 1 : -1];
+typedef char llgen_check_1 [(unsigned) (tok_identifier) < 256 ? 1 : -1];
+typedef char llgen_check_2 [(unsigned) ('+') < 256 ? 1 : -1];
+typedef char llgen_check_3 [(unsigned) ('*') < 256 ? 1 : -1];
+typedef char llgen_check_4 [(unsigned) ('(') < 256 ? 1 : -1];
+typedef char llgen_check_5 [(unsigned) (')') < 256 ? 1 : -1];
+
+static void llgen_init (void)
+{
+  llgen_terminal [EOF_TOKEN] = 1;	/* eof */
+  llgen_terminal [tok_identifier] = 2;	/* id */
+  llgen_terminal ['+'] = 3;	/* + */
+  llgen_terminal ['*'] = 4;	/* * */
+  llgen_terminal ['('] = 5;	/* ( */
+  llgen_terminal [')'] = 6;	/* ) */
+}
+
+# define TERMINAL(token) ((unsigned) (token) < 256 ? llgen_terminal [token] - 1 : -1)
+
+# include "DynArray.h"
+
+# define NONTERMINAL	64	/* NONTERMINAL + n: nonterminal n */
+# define END		(-1)
+
+static const tToken llgen_code [6] = { EOF_TOKEN, tok_identifier, '+', '*', '(', ')' };
+
+static char * llgen_error [5] = {
+  "Syntax Error in <E>",
+  "Syntax Error in <E1>",
+  "Syntax Error in <T>",
+  "Syntax Error in <T1>",
+  "Syntax Error in <F>",
+};
+
+static const int llgen_rhs [9][4] = {
+  { END },
+  { NONTERMINAL + 2, NONTERMINAL + 1, END },	/* 1) E  ::= T E1 */
+  { 2, NONTERMINAL + 2, NONTERMINAL + 1, END },	/* 2) E1 ::= + T E1 */
+  { END },	/* 3) E1 ::= epsilon */
+  { NONTERMINAL + 4, NONTERMINAL + 3, END },	/* 4) T  ::= F T1 */
+  { 3, NONTERMINAL + 4, NONTERMINAL + 3, END },	/* 5) T1 ::= * F T1 */
+  { END },	/* 6) T1 ::= epsilon */
+  { 4, NONTERMINAL + 0, 5, END },	/* 7) F  ::= ( E ) */
+  { 1, END },	/* 8) F  ::= id */
+};
+
+static const unsigned char llgen_table [5][6] = {
+  { 0, 1, 0, 0, 1, 0 },	/* E */
+  { 3, 0, 2, 0, 0, 3 },	/* E1 */
+  { 0, 4, 0, 0, 4, 0 },	/* T */
+  { 6, 0, 6, 5, 0, 6 },	/* T1 */
+  { 0, 8, 0, 0, 7, 0 },	/* F */
+};
+
+static int *	     llgen_stack = NULL;
+static unsigned long llgen_stack_size = 0;
+
+bool table_E (void)
+{
+  unsigned long depth = 0;
+
+  if (llgen_stack == NULL) {
+    llgen_init ();
+    llgen_stack_size = 256;
+    MakeArray ((char * *) & llgen_stack, & llgen_stack_size, sizeof (int));
+  }
+  llgen_stack [depth ++] = NONTERMINAL + 0;
+
+  while (depth > 0) {
+    int symbol = llgen_stack [-- depth];
+    if (symbol >= NONTERMINAL) {
+      int t = TERMINAL (CurToken), p, n;
+      if (t < 0 || (p = llgen_table [symbol - NONTERMINAL][t]) == 0) {
+	Message (llgen_error [symbol - NONTERMINAL], xxError, expr_scan_Attribute.Position);
+	return false; /* Syntax Error */
+      }
+      for (n = 0; llgen_rhs [p][n] != END; n ++) ;
+      while (depth + n > llgen_stack_size)
+	ExtendArray ((char * *) & llgen_stack, & llgen_stack_size, sizeof (int));
+      while (n > 0) llgen_stack [depth ++] = llgen_rhs [p][-- n];
+    } else if (! match (llgen_code [symbol])) {
+      return false; /* Syntax Error */
+    }
+  }
+  return true;
+}
@@ -0,0 +1,81 @@
+/* Project:  COCKTAIL training
+ * Descr:    A recursive Decent Parser for expressions
+ * Kind:     Parsing one expression per line
+ *
+ * The scanner reads every line from memory (expr_scan_BeginMemoryN), so
+ * the input is read once and a line costs no system call.
+ */
+
+# include <stdlib.h>
+# include <string.h>
+# include <fcntl.h>
+# include <unistd.h>
+# include "expr_scan.h"
+# include "parser.h"
+# include "ast.h"
+# include "tokens.h"
+# include "lines.h"
+
+char * ReadInput (char * FileName, size_t * Length)
+{
+  int	 fd = FileName == NULL ? 0 : open (FileName, O_RDONLY);
+  size_t size = 64 * 1024, length = 0;
+  char * text = NULL;
+  long	 n;
+
+  if (fd < 0) return NULL;
+  if ((text = malloc (size)) == NULL) goto fail;
+  while ((n = read (fd, text + length, size - length)) > 0) {
+    length += n;
+    if (length == size) {
+      char * t = realloc (text, size *= 2);
+      if (t == NULL) goto fail;
+      text = t;
+    }
+  }
+  if (n < 0) goto fail;
+  if (fd != 0) close (fd);
+  * Length = length;
+  return text;
+fail:
+  if (fd != 0) close (fd);
+  free (text);
+  return NULL;
+}
+
+bool ParseLine (char * Line, int Length, unsigned long LineNumber,
+		bool (* Parse) (void))
+{
+  ResetAst ();
+  ResetTokens ();
+  ResetSyntaxErrors ();
+  expr_scan_BeginMemoryN (Line, Length);
+  expr_scan_SetLine ((unsigned int) LineNumber);
+  CurToken = NextToken ();
+  if (Parse () && match (expr_scan_EofToken)) return true;
+  /* close the input of the line */
+  while (CurToken != expr_scan_EofToken) CurToken = NextToken ();
+  return false;
+}
+
+long ParseLines (char * Text, size_t Length, unsigned long FirstLine,
+		 bool (* Parse) (void), FILE * Out)
+{
+  char * end = Text + Length;
+  unsigned long line = FirstLine;
+  long errors = 0;
+
+  while (Text < end) {
+    char * eol = memchr (Text, '\n', end - Text);
+    if (eol == NULL) eol = end;
+    if (ParseLine (Text, (int) (eol - Text), line, Parse)) {
+      fprintf (Out, "%lu ok\n", line);
+    } else {
+      fprintf (Out, "%lu error\n", line);
+      errors ++;
+    }
+    Text = eol + 1;
+    line ++;
+  }
+  return errors;
+}
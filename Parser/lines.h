@@ -0,0 +1,32 @@
+/* Project:  COCKTAIL training
+ * Descr:    A recursive Decent Parser for expressions
+ * Kind:     Parsing one expression per line (interface)
+ */
+
+# ifndef lines_H
+# define lines_H
+
+# include <stdio.h>
+# include <stddef.h>
+# include "parser.h"
+
+extern char * ReadInput  (char * FileName, size_t * Length);
+/* Returns the contents of the file `FileName' (stdin if NULL) and its
+ * length in `Length', NULL if it cannot be read.
+ */
+
+extern bool   ParseLine  (char * Line, int Length, unsigned long LineNumber,
+			  bool (* Parse) (void));
+/* Parses `Line [0 .. Length-1]' as an expression using `Parse' (f_E,
+ * ll1_E or pratt_E), returns true iff it is one. The messages report the
+ * positions in line `LineNumber'.
+ */
+
+extern long   ParseLines (char * Text, size_t Length, unsigned long FirstLine,
+			  bool (* Parse) (void), FILE * Out);
+/* Parses every line of `Text [0 .. Length-1]' using ParseLine and writes
+ * "line ok" or "line error" to `Out', counting the lines from `FirstLine'.
+ * Returns the number of lines with syntax errors.
+ */
+
+# endif
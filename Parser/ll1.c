@@ -0,0 +1,118 @@
+/* Project:  COCKTAIL training
+ * Descr:    A recursive Decent Parser for expressions
+ * Kind:     Table driven LL(1) parser
+ *
+ * The stack holds the grammar symbols still to be derived: terminals are
+ * the token codes, nonterminals and the tree building actions are coded
+ * above them. The table maps a nonterminal and the class of `CurToken' to
+ * the production to expand, 0 meaning a syntax error.
+ */
+
+# include <string.h>
+# include "expr_scan.h"
+# include "parser.h"
+# include "ast.h"
+# include "DynArray.h"
+# include "Errors.h"
+# include "ll1.h"
+
+# define NONTERMINAL	256	/* NONTERMINAL + E .. NONTERMINAL + F */
+# define ACTION		512	/* ACTION + '+', ACTION + '*', LEAF    */
+# define LEAF		(ACTION + tok_identifier)
+# define END		(-1)
+
+enum { E, E1, T, T1, F };
+
+static char * error_msg [] = {
+  "Syntax Error in <E>", "Syntax Error in <E1>", "Syntax Error in <T>",
+  "Syntax Error in <T1>", "Syntax Error in <F>",
+};
+
+/******************************************************************************
+ * We use the following grammar for arithmetic expressions:
+ * 1)  E  ::= T E1
+ * 2)  E1 ::= + T E1       3)  E1 ::= epsilon
+ * 4)  T  ::= F T1
+ * 5)  T1 ::= * F T1       6)  T1 ::= epsilon
+ * 7)  F  ::= ( E )        8)  F  ::= id
+ * The actions build the tree like parser.c does.
+ ******************************************************************************/
+
+static const int rhs [9][6] = {
+  /* 0 */ { END },
+  /* 1 */ { NONTERMINAL + T, NONTERMINAL + E1, END },
+  /* 2 */ { '+', NONTERMINAL + T, ACTION + '+', NONTERMINAL + E1, END },
+  /* 3 */ { END },
+  /* 4 */ { NONTERMINAL + F, NONTERMINAL + T1, END },
+  /* 5 */ { '*', NONTERMINAL + F, ACTION + '*', NONTERMINAL + T1, END },
+  /* 6 */ { END },
+  /* 7 */ { '(', NONTERMINAL + E, ')', END },
+  /* 8 */ { LEAF, tok_identifier, END },
+};
+
+/* classes of tokens */
+enum { cEof, cId, cPlus, cTimes, cOpen, cClose, cOther, cCount };
+
+/* FIRST (alpha FOLLOW (X)) of the productions X ::= alpha, see parser.c */
+static const unsigned char table [5][cCount] = {
+  /*         eof id  +  *  (  )  other */
+  /* E  */ { 0,  1,  0, 0, 1, 0, 0 },
+  /* E1 */ { 3,  0,  2, 0, 0, 3, 0 },
+  /* T  */ { 0,  4,  0, 0, 4, 0, 0 },
+  /* T1 */ { 6,  0,  6, 5, 0, 6, 0 },
+  /* F  */ { 0,  8,  0, 0, 7, 0, 0 },
+};
+
+static int Class (tToken token)
+{
+  switch (token) {
+  case expr_scan_EofToken: return cEof;
+  case tok_identifier:     return cId;
+  case '+':                return cPlus;
+  case '*':                return cTimes;
+  case '(':                return cOpen;
+  case ')':                return cClose;
+  default:                 return cOther;
+  }
+}
+
+static int *	     stack = NULL;
+static unsigned long stack_size = 0;
+
+bool ll1_E (void)
+{
+  unsigned long depth = 0;
+
+  if (stack == NULL) {
+    stack_size = 256;
+    MakeArray ((char * *) & stack, & stack_size, sizeof (int));
+  }
+  stack [depth ++] = NONTERMINAL + E;
+
+  while (depth > 0) {
+    int symbol = stack [-- depth];
+
+    if (symbol >= ACTION) {
+      if (! BuildTree) continue;
+      if (symbol == LEAF)
+	PushLeaf (MakeIdent (expr_scan_Attribute.identifier.Value,
+			     strlen (expr_scan_Attribute.identifier.Value)));
+      else
+	PushBinary (symbol - ACTION);
+    } else if (symbol >= NONTERMINAL) {
+      int p = table [symbol - NONTERMINAL][Class (CurToken)];
+      int n;
+      if (p == 0) {
+	Message (error_msg [symbol - NONTERMINAL], xxError, expr_scan_Attribute.Position);
+	return false; /* Syntax Error */
+      }
+      for (n = 0; rhs [p][n] != END; n ++) ;
+      while (depth + n > stack_size)
+	ExtendArray ((char * *) & stack, & stack_size, sizeof (int));
+      while (n > 0) stack [depth ++] = rhs [p][-- n];	/* leftmost on top */
+    } else if (! match (symbol)) {
+      return false; /* Syntax Error */
+    }
+  }
+  return true;
+}
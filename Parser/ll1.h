@@ -0,0 +1,19 @@
+/* Project:  COCKTAIL training
+ * Descr:    A recursive Decent Parser for expressions
+ * Kind:     Table driven LL(1) parser (interface)
+ */
+
+# ifndef ll1_H
+# define ll1_H
+
+# include "parser.h"
+
+extern bool ll1_E (void);
+/* Same as f_E(), but driven by the LL(1) parse table of the grammar and an
+ * explicit stack of grammar symbols instead of recursion: it accepts and
+ * rejects the same inputs with the same messages, and builds the same tree
+ * if `BuildTree' is set. The native stack use does not depend on the
+ * nesting of the input.
+ */
+
+# endif
@@ -0,0 +1,494 @@
+/* Project:  COCKTAIL training
+ * Descr:    A Recursive Decent Parser for expressions
+ * Kind:     LL(1) parser generator
+ *
+ * usage: llgen [-s] [-r | -t] [-n name] grammar.bnf > parser.c
+ *
+ * Reads a grammar in the notation of README (see expr.bnf), computes the
+ * FIRST and FOLLOW sets and the sets FIRST (alpha FOLLOW (X)) of the
+ * productions X ::= alpha, and reports the LL(1) conflicts, i.e. two
+ * productions of a nonterminal whose sets intersect. Sets of terminals are
+ * 64 bit masks, so there are at most 64 terminals including eof. The
+ * token codes of the terminals have to be in 0 .. 255.
+ *
+ *   -s  writes the sets of the productions, like the comments of parser.c
+ *   -r  emits a recursive decent parser: one function per nonterminal,
+ *       every FIRST test is one mask check (default)
+ *   -t  emits a table driven parser with an explicit stack, like ll1.c
+ *   -n  the name of the function for the start symbol (default g_<start>)
+ *
+ * The emitted parsers use `CurToken' and `match ()' of parser.h and report
+ * errors like the f_* functions of parser.c. Exit code 1 on conflicts.
+ */
+
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+# include <stdint.h>
+
+# define MAX_TERMINALS	64	/* bits of a set */
+# define MAX_NONTERMS	64
+# define MAX_PRODS	256
+# define MAX_RHS	32
+# define MAX_LINES	1024
+# define MAX_LINE	1024
+
+typedef uint64_t tSet;
+
+# define BIT(t)		((tSet) 1 << (t))
+# define NT(n)		(-1 - (n))	/* nonterminals in right hand sides */
+# define IS_NT(s)	((s) < 0)
+
+typedef struct {
+  int lhs, len, line;
+  int rhs [MAX_RHS];
+} tProd;
+
+static char * grammar;
+static char * term_name  [MAX_TERMINALS], * term_code [MAX_TERMINALS];
+static int    term_count = 1;			/* 0 is eof */
+static char * nt_name    [MAX_NONTERMS];
+static int    nt_count;
+static tProd  prod       [MAX_PRODS];
+static int    prod_count;
+static char * includes   [MAX_LINES];
+static int    include_count;
+static char * position   = "NoPosition";
+
+static tSet   first      [MAX_NONTERMS];
+static int    nullable   [MAX_NONTERMS];
+static int    productive [MAX_NONTERMS];	/* derives a terminal string */
+static tSet   follow     [MAX_NONTERMS];
+static tSet   predict    [MAX_PRODS];
+
+static void Fatal (int line, char * msg, char * arg)
+{
+  fprintf (stderr, "%s:%d: %s%s\n", grammar, line, msg, arg);
+  exit (2);
+}
+
+static int Nonterminal (char * name)
+{
+  int n;
+  for (n = 0; n < nt_count; n ++)
+    if (strcmp (nt_name [n], name) == 0) return n;
+  return -1;
+}
+
+static int Terminal (char * name)
+{
+  int t;
+  for (t = 0; t < term_count; t ++)
+    if (strcmp (term_name [t], name) == 0) return t;
+  if (term_count == MAX_TERMINALS) Fatal (0, "too many terminals at ", name);
+  term_name [term_count] = strdup (name);
+  term_code [term_count] = NULL;
+  return term_count ++;
+}
+
+/* the C expression for the token code of terminal t */
+static char * Code (int t)
+{
+  if (term_code [t] == NULL) {
+    char buffer [16];
+    if (strlen (term_name [t]) != 1) Fatal (0, "no %token for terminal ", term_name [t]);
+    if (term_name [t][0] == '\'' || term_name [t][0] == '\\')
+      sprintf (buffer, "'\\%c'", term_name [t][0]);
+    else
+      sprintf (buffer, "'%c'", term_name [t][0]);
+    term_code [t] = strdup (buffer);
+  }
+  return term_code [t];
+}
+
+/*****************************************************************************
+ * reading the grammar
+ *****************************************************************************/
+
+static void Read (FILE * f)
+{
+  static char lines [MAX_LINES][MAX_LINE];
+  int line_count = 0, l;
+
+  term_name [0] = "eof";
+  term_code [0] = "0";
+  for (;;) {
+    if (line_count == MAX_LINES) {
+      if (getc (f) != EOF) Fatal (MAX_LINES + 1, "too many lines", "");
+      break;
+    }
+    if (fgets (lines [line_count], MAX_LINE, f) == NULL) break;
+    if (strchr (lines [line_count], '\n') == NULL) {
+      int c = getc (f);
+      if (c != EOF) Fatal (line_count + 1, "line too long", "");
+    }
+    line_count ++;
+  }
+
+  /* the nonterminals first, so they may be used before their productions */
+  for (l = 0; l < line_count; l ++) {
+    char name [MAX_LINE], arrow [MAX_LINE];
+    if (sscanf (lines [l], "%s %s", name, arrow) == 2 && name [0] != '#' &&
+	strcmp (arrow, "::=") == 0 && Nonterminal (name) < 0) {
+      if (nt_count == MAX_NONTERMS) Fatal (l + 1, "too many nonterminals at ", name);
+      nt_name [nt_count ++] = strdup (name);
+    }
+  }
+  if (nt_count == 0) Fatal (0, "no productions", "");
+
+  for (l = 0; l < line_count; l ++) {
+    char * s = lines [l], * word;
+    tProd * p;
+    s [strcspn (s, "\r\n")] = '\0';
+    while (* s == ' ' || * s == '\t') s ++;
+    if (* s == '\0' || * s == '#') continue;
+
+    if (* s == '%') {
+      char directive [MAX_LINE], arg1 [MAX_LINE], arg2 [MAX_LINE];
+      int n = sscanf (s, "%s %s %s", directive, arg1, arg2);
+      if (strcmp (directive, "%include") == 0 && n >= 2) {
+	includes [include_count ++] = strdup (arg1);
+      } else if (strcmp (directive, "%token") == 0 && n == 3) {
+	char * end;
+	long code = strtol (arg2, & end, 0);
+	if (* end == '\0' && (code < 0 || code > 255))
+	  Fatal (l + 1, "token code not in 0 .. 255: ", arg2);
+	term_code [strcmp (arg1, "eof") == 0 ? 0 : Terminal (arg1)] = strdup (arg2);
+      } else if (strcmp (directive, "%position") == 0 && n == 2) {
+	position = strdup (arg1);
+      } else {
+	Fatal (l + 1, "bad directive ", s);
+      }
+      continue;
+    }
+
+    /* X ::= sym ... [ | sym ... ] */
+    if (prod_count == MAX_PRODS) Fatal (l + 1, "too many productions", "");
+    p = & prod [prod_count ++];
+    p->lhs  = Nonterminal (strtok (s, " \t"));
+    p->len  = 0;
+    p->line = l + 1;
+    if ((word = strtok (NULL, " \t")) == NULL || strcmp (word, "::=") != 0)
+      Fatal (l + 1, "::= expected", "");
+    while ((word = strtok (NULL, " \t")) != NULL) {
+      if (strcmp (word, "epsilon") == 0) continue;
+      if (strcmp (word, "|") == 0) {			/* next alternative */
+	if (prod_count == MAX_PRODS) Fatal (l + 1, "too many productions", "");
+	prod [prod_count].lhs  = p->lhs;
+	prod [prod_count].line = p->line;
+	prod [prod_count].len  = 0;
+	p = & prod [prod_count ++];
+	continue;
+      }
+      if (p->len == MAX_RHS) Fatal (l + 1, "right hand side too long", "");
+      p->rhs [p->len ++] = Nonterminal (word) >= 0 ? NT (Nonterminal (word)) : Terminal (word);
+    }
+  }
+}
+
+/*****************************************************************************
+ * FIRST, FOLLOW and the sets of the productions
+ *****************************************************************************/
+
+/* FIRST of rhs [0 .. len-1]; * empty: the sequence derives epsilon */
+static tSet FirstOf (int * rhs, int len, int * empty)
+{
+  tSet set = 0;
+  int i;
+  for (i = 0; i < len; i ++) {
+    if (! IS_NT (rhs [i])) { * empty = 0; return set | BIT (rhs [i]); }
+    set |= first [NT (rhs [i])];
+    if (! nullable [NT (rhs [i])]) { * empty = 0; return set; }
+  }
+  * empty = 1;
+  return set;
+}
+
+static void Sets (void)
+{
+  int changed, p, i, empty;
+
+  do {						/* productive nonterminals */
+    changed = 0;
+    for (p = 0; p < prod_count; p ++) {
+      if (productive [prod [p].lhs]) continue;
+      for (i = 0; i < prod [p].len; i ++)
+	if (IS_NT (prod [p].rhs [i]) && ! productive [NT (prod [p].rhs [i])]) break;
+      if (i == prod [p].len) { productive [prod [p].lhs] = 1; changed = 1; }
+    }
+  } while (changed);
+
+  do {
+    changed = 0;
+    for (p = 0; p < prod_count; p ++) {
+      tSet set = FirstOf (prod [p].rhs, prod [p].len, & empty);
+      int  x = prod [p].lhs;
+      if ((first [x] | set) != first [x]) { first [x] |= set; changed = 1; }
+      if (empty && ! nullable [x]) { nullable [x] = 1; changed = 1; }
+    }
+  } while (changed);
+
+  follow [0] = BIT (0);				/* eof follows the start symbol */
+  do {
+    changed = 0;
+    for (p = 0; p < prod_count; p ++) {
+      for (i = 0; i < prod [p].len; i ++) {
+	int  b = prod [p].rhs [i];
+	tSet set;
+	if (! IS_NT (b)) continue;
+	b = NT (b);
+	set = FirstOf (prod [p].rhs + i + 1, prod [p].len - i - 1, & empty);
+	if (empty) set |= follow [prod [p].lhs];
+	if ((follow [b] | set) != follow [b]) { follow [b] |= set; changed = 1; }
+      }
+    }
+  } while (changed);
+
+  for (p = 0; p < prod_count; p ++) {
+    predict [p] = FirstOf (prod [p].rhs, prod [p].len, & empty);
+    if (empty) predict [p] |= follow [prod [p].lhs];
+  }
+}
+
+static void WriteSet (FILE * f, tSet set)
+{
+  int t;
+  fprintf (f, "{");
+  for (t = 0; t < term_count; t ++)
+    if (set & BIT (t)) fprintf (f, " %s", term_name [t]);
+  fprintf (f, " }");
+}
+
+static int Conflicts (void)
+{
+  int p, q, count = 0;
+  for (p = 0; p < prod_count; p ++)
+    for (q = p + 1; q < prod_count; q ++)
+      if (prod [p].lhs == prod [q].lhs && (predict [p] & predict [q]) != 0) {
+	fprintf (stderr, "%s:%d: LL(1) conflict of %s between productions %d) and %d) on ",
+		 grammar, prod [q].line, nt_name [prod [q].lhs], p + 1, q + 1);
+	WriteSet (stderr, predict [p] & predict [q]);
+	fprintf (stderr, "\n");
+	count ++;
+      }
+  for (p = 0; p < nt_count; p ++)
+    if (! productive [p]) {
+      fprintf (stderr, "%s: %s derives no terminal string\n", grammar, nt_name [p]);
+      count ++;
+    }
+  return count;
+}
+
+static void WriteProd (FILE * f, int p)
+{
+  int i;
+  fprintf (f, "%-2s ::=", nt_name [prod [p].lhs]);
+  if (prod [p].len == 0) fprintf (f, " epsilon");
+  for (i = 0; i < prod [p].len; i ++) {
+    int s = prod [p].rhs [i];
+    fprintf (f, " %s", IS_NT (s) ? nt_name [NT (s)] : term_name [s]);
+  }
+}
+
+static void WriteSets (FILE * f)
+{
+  int p;
+  for (p = 0; p < prod_count; p ++) {
+    fprintf (f, "%d) ", p + 1);
+    WriteProd (f, p);
+    fprintf (f, "\t\t");
+    WriteSet (f, predict [p]);
+    fprintf (f, "\n");
+  }
+}
+
+/*****************************************************************************
+ * code generation
+ *****************************************************************************/
+
+static char * start_name;
+
+static char * FunctionName (int n)
+{
+  static char buffer [MAX_LINE];
+  if (n == 0) return start_name;
+  sprintf (buffer, "g_%s", nt_name [n]);
+  return buffer;
+}
+
+static void EmitHead (FILE * f, char * kind)
+{
+  int i, t;
+  fprintf (f, "/* %s parser generated by llgen from %s, do not edit */\n\n", kind, grammar);
+  fprintf (f, "# include <stdint.h>\n");
+  for (i = 0; i < include_count; i ++) fprintf (f, "# include %s\n", includes [i]);
+  fprintf (f, "# include \"Errors.h\"\n\n");
+  fprintf (f, "# define EOF_TOKEN %s\n\n", term_code [0]);
+
+  /* the terminal of a token code, set up at the first call */
+  fprintf (f, "static int llgen_terminal [256];	/* terminal + 1, 0: none */\n\n");
+  fprintf (f, "/* the token codes have to be in 0 .. 255 */\n");
+  for (t = 0; t < term_count; t ++)
+    fprintf (f, "typedef char llgen_check_%d [(unsigned) (%s) < 256 ? 1 : -1];\n", t, t == 0 ? "EOF_TOKEN" : Code (t));
+  fprintf (f, "\n");
+  fprintf (f, "static void llgen_init (void)\n{\n");
+  for (t = 0; t < term_count; t ++)
+    fprintf (f, "  llgen_terminal [%s] = %d;\t/* %s */\n", t == 0 ? "EOF_TOKEN" : Code (t), t + 1, term_name [t]);
+  fprintf (f, "}\n\n");
+  fprintf (f, "# define TERMINAL(token) ((unsigned) (token) < 256 ? llgen_terminal [token] - 1 : -1)\n\n");
+}
+
+static void EmitRecursive (FILE * f)
+{
+  int n, p, i;
+
+  EmitHead (f, "Recursive decent");
+  fprintf (f, "/* CurToken is element of `set' */\n");
+  fprintf (f, "# define IN(set) (TERMINAL (CurToken) >= 0 && ((UINT64_C (1) << TERMINAL (CurToken)) & UINT64_C (set)) != 0)\n\n");
+
+  for (n = 1; n < nt_count; n ++)
+    fprintf (f, "static bool %s (void);\n", FunctionName (n));
+  fprintf (f, "\n");
+
+  for (n = 0; n < nt_count; n ++) {
+    fprintf (f, "%sbool %s (void)\n{\n", n == 0 ? "" : "static ", FunctionName (n));
+    if (n == 0) {
+      fprintf (f, "  static bool initialized = false;\n");
+      fprintf (f, "  if (! initialized) { llgen_init (); initialized = true; }\n\n");
+    }
+    for (p = 0; p < prod_count; p ++) {
+      if (prod [p].lhs != n) continue;
+      fprintf (f, "  /* ");
+      WriteProd (f, p);
+      fprintf (f, " */\n");
+      fprintf (f, "  if (IN (0x%016llx)) return ", (unsigned long long) predict [p]);
+      if (prod [p].len == 0) fprintf (f, "true");
+      for (i = 0; i < prod [p].len; i ++) {
+	int s = prod [p].rhs [i];
+	if (i > 0) fprintf (f, " && ");
+	if (IS_NT (s)) fprintf (f, "%s ()", FunctionName (NT (s)));
+	else	       fprintf (f, "match (%s)", s == 0 ? "EOF_TOKEN" : Code (s));
+      }
+      fprintf (f, ";\n");
+    }
+    fprintf (f, "  Message (\"Syntax Error in <%s>\", xxError, %s);\n", nt_name [n], position);
+    fprintf (f, "  return false; /* Syntax Error */\n}\n\n");
+  }
+}
+
+static void EmitTable (FILE * f)
+{
+  int n, p, i, t, max_len = 0;
+
+  EmitHead (f, "Table driven");
+  fprintf (f, "# include \"DynArray.h\"\n\n");
+  fprintf (f, "# define NONTERMINAL\t%d\t/* NONTERMINAL + n: nonterminal n */\n", MAX_TERMINALS);
+  fprintf (f, "# define END\t\t(-1)\n\n");
+
+  fprintf (f, "static const tToken llgen_code [%d] = {", term_count);
+  for (t = 0; t < term_count; t ++)
+    fprintf (f, "%s %s", t == 0 ? "" : ",", t == 0 ? "EOF_TOKEN" : Code (t));
+  fprintf (f, " };\n\n");
+
+  fprintf (f, "static char * llgen_error [%d] = {\n", nt_count);
+  for (n = 0; n < nt_count; n ++)
+    fprintf (f, "  \"Syntax Error in <%s>\",\n", nt_name [n]);
+  fprintf (f, "};\n\n");
+
+  for (p = 0; p < prod_count; p ++)
+    if (prod [p].len > max_len) max_len = prod [p].len;
+  fprintf (f, "static const int llgen_rhs [%d][%d] = {\n", prod_count + 1, max_len + 1);
+  fprintf (f, "  { END },\n");
+  for (p = 0; p < prod_count; p ++) {
+    fprintf (f, "  {");
+    for (i = 0; i < prod [p].len; i ++) {
+      int s = prod [p].rhs [i];
+      if (IS_NT (s)) fprintf (f, " NONTERMINAL + %d,", NT (s));
+      else	     fprintf (f, " %d,", s);
+    }
+    fprintf (f, " END },\t/* %d) ", p + 1);
+    WriteProd (f, p);
+    fprintf (f, " */\n");
+  }
+  fprintf (f, "};\n\n");
+
+  /* the production to expand for nonterminal and terminal, 0: error */
+  fprintf (f, "static const unsigned char llgen_table [%d][%d] = {\n", nt_count, term_count);
+  for (n = 0; n < nt_count; n ++) {
+    fprintf (f, "  {");
+    for (t = 0; t < term_count; t ++) {
+      int chosen = 0;
+      for (p = prod_count - 1; p >= 0; p --)	/* the first one on conflicts */
+	if (prod [p].lhs == n && (predict [p] & BIT (t))) chosen = p + 1;
+      fprintf (f, " %d%s", chosen, t + 1 < term_count ? "," : "");
+    }
+    fprintf (f, " },\t/* %s */\n", nt_name [n]);
+  }
+  fprintf (f, "};\n\n");
+
+  fprintf (f, "static int *\t     llgen_stack = NULL;\n");
+  fprintf (f, "static unsigned long llgen_stack_size = 0;\n\n");
+  fprintf (f, "bool %s (void)\n{\n", start_name);
+  fprintf (f, "  unsigned long depth = 0;\n\n");
+  fprintf (f, "  if (llgen_stack == NULL) {\n");
+  fprintf (f, "    llgen_init ();\n");
+  fprintf (f, "    llgen_stack_size = 256;\n");
+  fprintf (f, "    MakeArray ((char * *) & llgen_stack, & llgen_stack_size, sizeof (int));\n");
+  fprintf (f, "  }\n");
+  fprintf (f, "  llgen_stack [depth ++] = NONTERMINAL + 0;\n\n");
+  fprintf (f, "  while (depth > 0) {\n");
+  fprintf (f, "    int symbol = llgen_stack [-- depth];\n");
+  fprintf (f, "    if (symbol >= NONTERMINAL) {\n");
+  fprintf (f, "      int t = TERMINAL (CurToken), p, n;\n");
+  fprintf (f, "      if (t < 0 || (p = llgen_table [symbol - NONTERMINAL][t]) == 0) {\n");
+  fprintf (f, "\tMessage (llgen_error [symbol - NONTERMINAL], xxError, %s);\n", position);
+  fprintf (f, "\treturn false; /* Syntax Error */\n");
+  fprintf (f, "      }\n");
+  fprintf (f, "      for (n = 0; llgen_rhs [p][n] != END; n ++) ;\n");
+  fprintf (f, "      while (depth + n > llgen_stack_size)\n");
+  fprintf (f, "\tExtendArray ((char * *) & llgen_stack, & llgen_stack_size, sizeof (int));\n");
+  fprintf (f, "      while (n > 0) llgen_stack [depth ++] = llgen_rhs [p][-- n];\n");
+  fprintf (f, "    } else if (! match (llgen_code [symbol])) {\n");
+  fprintf (f, "      return false; /* Syntax Error */\n");
+  fprintf (f, "    }\n");
+  fprintf (f, "  }\n");
+  fprintf (f, "  return true;\n");
+  fprintf (f, "}\n");
+}
+
+int main (int argc, char * argv [])
+{
+  int i, table = 0, sets = 0, conflicts;
+  FILE * f;
+
+  for (i = 1; i < argc && argv [i][0] == '-'; i ++) {
+    if      (strcmp (argv [i], "-r") == 0) table = 0;
+    else if (strcmp (argv [i], "-t") == 0) table = 1;
+    else if (strcmp (argv [i], "-s") == 0) sets = 1;
+    else if (strcmp (argv [i], "-n") == 0 && i + 1 < argc) start_name = argv [++ i];
+    else break;
+  }
+  if (i + 1 != argc) {
+    fprintf (stderr, "usage: llgen [-s] [-r | -t] [-n name] grammar.bnf > parser.c\n");
+    return 2;
+  }
+  grammar = argv [i];
+  if ((f = fopen (grammar, "r")) == NULL) {
+    fprintf (stderr, "llgen: cannot open %s\n", grammar);
+    return 2;
+  }
+  Read (f);
+  fclose (f);
+  if (start_name == NULL) {
+    start_name = malloc (strlen (nt_name [0]) + 3);
+    sprintf (start_name, "g_%s", nt_name [0]);
+  }
+  for (i = 1; i < term_count; i ++) Code (i);	/* every terminal needs one */
+
+  Sets ();
+  conflicts = Conflicts ();
+  if (sets) WriteSets (stdout);
+  else if (table) EmitTable (stdout);
+  else EmitRecursive (stdout);
+  return conflicts > 0;
+}
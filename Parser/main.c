@@ -11,30 +11,171 @@
 # include "Position.h"
 # include "expr_scan.h"
 # include "parser.h"
+# include "tokens.h"
+# include "ll1.h"
+# include "pratt.h"
+# include "vm.h"
+# include "batch.h"
+# include "lines.h"
+# include "parallel.h"
+# include "expr_gen.h"
 
-int
-main (int argc, char *argv[])
+static void
+Usage (int Status)
 {
-   if (argc == 2) {
-     if (strcmp (argv[1], "-h") == 0) {
-       fprintf (stderr,
-		"usage: parser [-h] [file]\n"
+   fprintf (stderr,
+		"usage: parser [-h] [-t] [-l | -p] [-c] [-e] [-b rows] [-d name=value]... [file]\n"
+		"       parser -g | -G [file]\n"
+		"       parser -r [file]\n"
+		"       parser -m [-j workers] [-l | -p | -g | -G] [file]\n"
 		"  parser for expressions, reads `file' or stdin\n"
 		"  -h: Help.\n"
+		"  -t: print the syntax tree of the expression\n"
+		"  -l: use the table driven parser instead of the recursive one\n"
+		"  -p: use the precedence climbing parser\n"
+		"  -g: use the recursive decent parser generated from expr.bnf\n"
+		"  -G: use the table driven parser generated from expr.bnf\n"
+		"      (both check the syntax only, they build no tree)\n"
+		"  -r: report all syntax errors, recovering from each one\n"
+		"  -c: print the bytecode of the expression\n"
+		"  -e: evaluate the expression, `name' is `value' (default 0)\n"
+		"  -b: evaluate the expression for `rows' rows, `name' is\n"
+		"      `value' + the row number in a row, print the sum\n"
+		"  -m: parse every line as an expression of its own,\n"
+		"      print `line ok' or `line error' for each\n"
+		"  -j: same as -m, parsing with `workers' processes\n"
 		"Exit-codes:  0 : no Syntaxerrors\n"
 		"            -1 : Syntaxerrors found\n");
-       exit (0);
+   exit (Status);
+}
+
+int
+main (int argc, char *argv[])
+{
+   int i, n, Defined = 0;
+   bool (* parse) (void) = f_E;
+   bool PrintTree = false, Eval = false, ListCode = false, Multi = false;
+   unsigned long Rows = 0;
+   int Workers = 1;
+   tIdent * Names  = (tIdent *) malloc (argc * sizeof (tIdent));
+   double * Values = (double *) malloc (argc * sizeof (double));
+   for (i = 1; i < argc && argv[i][0] == '-'; i ++) {
+     if (strcmp (argv[i], "-t") == 0) {
+       BuildTree = PrintTree = true;
+     } else if (strcmp (argv[i], "-e") == 0) {
+       BuildTree = Eval = true;
+     } else if (strcmp (argv[i], "-c") == 0) {
+       BuildTree = ListCode = true;
+     } else if (strcmp (argv[i], "-b") == 0 && i + 1 < argc) {
+       BuildTree = true;
+       Rows = strtoul (argv[++ i], NULL, 10);
+     } else if (strcmp (argv[i], "-d") == 0 && i + 1 < argc &&
+		strchr (argv[i + 1], '=') != NULL) {
+       char * Def = argv[++ i];
+       Names  [Defined] = MakeIdent (Def, strchr (Def, '=') - Def);
+       Values [Defined ++] = atof (strchr (Def, '=') + 1);
+     } else if (strcmp (argv[i], "-m") == 0) {
+       Multi = true;
+     } else if (strcmp (argv[i], "-j") == 0 && i + 1 < argc) {
+       Multi = true;
+       Workers = atoi (argv[++ i]);
+     } else if (strcmp (argv[i], "-g") == 0) {
+       parse = rd_E;
+     } else if (strcmp (argv[i], "-G") == 0) {
+       parse = table_E;
+     } else if (strcmp (argv[i], "-r") == 0) {
+       Recover = true;
+     } else if (strcmp (argv[i], "-l") == 0) {
+       parse = ll1_E;
+     } else if (strcmp (argv[i], "-p") == 0) {
+       parse = pratt_E;
+     } else {
+       Usage (strcmp (argv[i], "-h") == 0 ? 0 : 1);
      }
-     expr_scan_Attribute.Position.FileName = MakeIdent (argv[1], strlen (argv[1]));
-     expr_scan_BeginFile (argv[1]);
+   }
+   if (Recover && (parse != f_E || BuildTree || Multi)) {
+     fprintf (stderr, "parser: -r does not combine with -t, -l, -p, -g, -G, -c, -e, -b, -m or -j\n");
+     Usage (1);
+   }
+   if ((parse == rd_E || parse == table_E) && BuildTree) {
+     fprintf (stderr, "parser: -g and -G build no tree for -t, -c, -e or -b\n");
+     Usage (1);
+   }
+   if (Multi) {
+     static char Buffer [64 * 1024];
+     size_t Length;
+     char * Text = ReadInput (i < argc ? argv[i] : NULL, & Length);
+     long Errors;
+     if (Text == NULL) {
+       fprintf (stderr, "parser: cannot read %s\n", i < argc ? argv[i] : "stdin");
+       return -1;
+     }
+     if (i < argc) expr_scan_Attribute.Position.FileName = MakeIdent (argv[i], strlen (argv[i]));
+     setvbuf (stdout, Buffer, _IOFBF, sizeof (Buffer));
+     if (Workers > 1)
+       Errors = ParseParallel (Text, Length, parse, Workers, stdout);
+     else
+       Errors = ParseLines (Text, Length, 1, parse, stdout);
+     printf (Errors == 0 ? "*** ok\n" : "*** error\n");
+     free (Text);
+     return Errors == 0 ? 0 : -1;
+   }
+   if (i < argc) {
+     expr_scan_Attribute.Position.FileName = MakeIdent (argv[i], strlen (argv[i]));
+     expr_scan_BeginFile (argv[i]);
      /* Read form file, if this is not called the scanner reads form stdin */
    }
 
    /* get the first token */
-   CurToken = expr_scan_GetToken();
+   CurToken = NextToken ();
+
+   if (Recover) {
+     if (f_Input ()) {
+       printf ("*** ok\n");
+       return 0;
+     }
+     printf ("*** error (%d syntax errors)\n", SyntaxErrors);
+     return -1;
+   }
 
    /* Call the parser with the grammar root symbol */
-   if (f_E() && match (expr_scan_EofToken)) {
+   if (parse () && match (expr_scan_EofToken)) {
+     if (PrintTree) { WriteAst (stdout, TopNode ()); printf ("\n"); }
+     if (ListCode || Eval || Rows > 0) {
+       tCode Code = { NULL, 0, 0, 0 };
+       if (! CompileAst (TopNode (), & Code)) {
+	 printf ("*** cannot compile\n");
+	 return -1;
+       }
+       if (ListCode) WriteCode (stdout, & Code);
+       if (Eval) {
+	 double * Bindings = (double *) calloc (MaxIdent () + 1, sizeof (double));
+	 for (n = 0; n < Defined; n ++) Bindings [Names [n]] = Values [n];
+	 printf ("value: %g\n", Evaluate (& Code, Bindings));
+	 free (Bindings);
+       }
+       if (Rows > 0) {
+	 tIdent Max = MaxIdent ();
+	 double ** Columns = (double **) calloc (Max + 1, sizeof (double *));
+	 double * Result = (double *) malloc (Rows * sizeof (double));
+	 double Sum = 0, Base;
+	 unsigned long r;
+	 tIdent Id;
+	 for (Id = 1; Id <= Max; Id ++) {
+	   Columns [Id] = (double *) malloc (Rows * sizeof (double));
+	   for (Base = 0, n = 0; n < Defined; n ++) if (Names [n] == Id) Base = Values [n];
+	   for (r = 0; r < Rows; r ++) Columns [Id][r] = Base + r;
+	 }
+	 EvaluateBatch (& Code, (const double * const *) Columns, Result, Rows);
+	 for (r = 0; r < Rows; r ++) Sum += Result [r];
+	 printf ("rows: %lu, sum: %g\n", Rows, Sum);
+	 for (Id = 1; Id <= Max; Id ++) free (Columns [Id]);
+	 free (Columns);
+	 free (Result);
+	 ReleaseBatch ();
+       }
+       ReleaseCode (& Code);
+     }
      printf ("*** ok\n");
      return 0;
    } else {
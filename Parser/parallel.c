@@ -0,0 +1,190 @@
+/* Project:  COCKTAIL training
+ * Descr:    A recursive Decent Parser for expressions
+ * Kind:     Parsing lines of expressions in parallel
+ *
+ * The scanner and the parser keep their state in global variables, so the
+ * workers are processes, each one with its own copy. The input is split
+ * into chunks at line ends before the workers are forked. The workers
+ * share a page holding the number of the next chunk to take, incremented
+ * atomically, and one status byte per line, which the parent writes out in
+ * the order of the lines after all workers are done. Workers which finish
+ * their chunk early take the next one, so long lines in one part of the
+ * input do not leave the others waiting.
+ *
+ * Every worker writes its messages into a temporary file of its own and
+ * records where the messages of each chunk are, so the parent can copy
+ * them to stderr in the order of the lines as well. The parent checks the
+ * exit status of every worker; the lines a failed worker left unparsed are
+ * reported as such.
+ */
+
+# include <stdlib.h>
+# include <string.h>
+# include <unistd.h>
+# include <sys/mman.h>
+# include <sys/types.h>
+# include <sys/wait.h>
+# include "lines.h"
+# include "parallel.h"
+
+# define NOT_PARSED	0	/* the worker failed */
+# define LINE_OK	1
+# define LINE_ERROR	2
+
+typedef struct {
+  size_t	Start, End;	/* bytes of the input */
+  unsigned long	FirstLine;	/* counted from 0 */
+  int		Worker;		/* which parsed it, -1 if none */
+  off_t		MsgStart, MsgEnd; /* its messages in the file of the worker,
+				   MsgEnd < 0 if the worker did not finish */
+} tChunk;
+
+typedef struct {
+  long		NextChunk;
+  unsigned char	Status [1];	/* one per line */
+} tShared;
+
+static void Work (int Worker, char * Text, tChunk * Chunks, long ChunkCount,
+		  bool (* Parse) (void), tShared * Shared)
+{
+  long k;
+  while ((k = __sync_fetch_and_add (& Shared->NextChunk, 1)) < ChunkCount) {
+    char * line = Text + Chunks [k].Start, * end = Text + Chunks [k].End;
+    unsigned long n = Chunks [k].FirstLine;
+    Chunks [k].MsgStart = lseek (2, 0, SEEK_CUR);
+    Chunks [k].MsgEnd = -1;
+    Chunks [k].Worker = Worker;
+    while (line < end) {
+      char * eol = memchr (line, '\n', end - line);
+      if (eol == NULL) eol = end;
+      Shared->Status [n] = ParseLine (line, (int) (eol - line), n + 1, Parse) ? LINE_OK : LINE_ERROR;
+      n ++;
+      line = eol + 1;
+    }
+    fflush (stderr);
+    Chunks [k].MsgEnd = lseek (2, 0, SEEK_CUR);
+  }
+}
+
+/* Copies the bytes `Start .. End-1' of `File' to stderr, up to its end if
+ * End < 0
+ */
+static void CopyMessages (FILE * File, off_t Start, off_t End)
+{
+  char buffer [4096];
+  size_t n;
+  if (fseeko (File, Start, SEEK_SET) != 0) return;
+  while ((End < 0 || Start < End) &&
+	 (n = fread (buffer, 1, End < 0 || End - Start > (off_t) sizeof (buffer) ?
+			 sizeof (buffer) : (size_t) (End - Start), File)) > 0) {
+    fwrite (buffer, 1, n, stderr);
+    Start += n;
+  }
+}
+
+long ParseParallel (char * Text, size_t Length, bool (* Parse) (void),
+		    int Workers, FILE * Out)
+{
+  tChunk *	chunks;
+  long		chunk_count = 0, errors = 0, k;
+  unsigned long	lines = 0, n;
+  size_t	start, chunks_size, shared_size;
+  tShared *	shared;
+  FILE * *	messages;
+  pid_t *	pids;
+  int		started = 0, failed = 0, w;
+
+  /* the chunks are shared as well, the workers record their messages */
+  chunks_size = (Length / PARALLEL_CHUNK + 1) * sizeof (tChunk);
+  chunks = mmap (NULL, chunks_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if (chunks == MAP_FAILED) return ParseLines (Text, Length, 1, Parse, Out);
+
+  /* split at line ends */
+  for (start = 0; start < Length; ) {
+    size_t end = start + PARALLEL_CHUNK;
+    char * p;
+    if (end >= Length) {
+      end = Length;
+    } else {
+      char * eol = memchr (Text + end, '\n', Length - end);
+      end = eol == NULL ? Length : (size_t) (eol - Text) + 1;
+    }
+    chunks [chunk_count].Start = start;
+    chunks [chunk_count].End = end;
+    chunks [chunk_count].Worker = -1;
+    chunks [chunk_count ++].FirstLine = lines;
+    for (p = Text + start; (p = memchr (p, '\n', Text + end - p)) != NULL; p ++) lines ++;
+    if (end == Length && Text [Length - 1] != '\n') lines ++;
+    start = end;
+  }
+
+  shared_size = sizeof (tShared) + lines;
+  shared = mmap (NULL, shared_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  messages = calloc (Workers, sizeof (FILE *));
+  pids = calloc (Workers, sizeof (pid_t));
+  if (shared == MAP_FAILED || messages == NULL || pids == NULL) goto fallback;
+  memset (shared, 0, shared_size);
+
+  fflush (Out);
+  fflush (stderr);
+  for (w = 0; w < Workers; w ++) {
+    if ((messages [w] = tmpfile ()) == NULL) break;
+    pids [w] = fork ();
+    if (pids [w] == 0) {
+      dup2 (fileno (messages [w]), 2);
+      Work (w, Text, chunks, chunk_count, Parse, shared);
+      fflush (stderr);
+      _exit (0);
+    }
+    if (pids [w] < 0) break;
+    started ++;
+  }
+  if (started == 0) goto fallback;
+
+  for (w = 0; w < started; w ++) {
+    int status;
+    if (waitpid (pids [w], & status, 0) < 0) {
+      fprintf (stderr, "parser: worker %d lost\n", w);
+      failed ++;
+    } else if (WIFSIGNALED (status)) {
+      fprintf (stderr, "parser: worker %d killed by signal %d\n", w, WTERMSIG (status));
+      failed ++;
+    } else if (WEXITSTATUS (status) != 0) {
+      fprintf (stderr, "parser: worker %d failed with exit status %d\n", w, WEXITSTATUS (status));
+      failed ++;
+    }
+  }
+
+  for (k = 0; k < chunk_count; k ++)
+    if (chunks [k].Worker >= 0)
+      CopyMessages (messages [chunks [k].Worker], chunks [k].MsgStart,
+		    chunks [k].MsgEnd);
+
+  for (n = 0; n < lines; n ++) {
+    if (shared->Status [n] == LINE_OK) {
+      fprintf (Out, "%lu ok\n", n + 1);
+    } else if (shared->Status [n] == LINE_ERROR) {
+      fprintf (Out, "%lu error\n", n + 1);
+      errors ++;
+    } else {
+      fprintf (Out, "%lu not parsed\n", n + 1);
+      errors ++;
+    }
+  }
+  if (failed > 0) fprintf (stderr, "parser: %d of %d workers failed\n", failed, started);
+  for (w = 0; w < Workers && messages [w] != NULL; w ++) fclose (messages [w]);
+  free (messages);
+  free (pids);
+  munmap (shared, shared_size);
+  munmap (chunks, chunks_size);
+  return errors;
+
+fallback:
+  if (messages != NULL)
+    for (w = 0; w < Workers && messages [w] != NULL; w ++) fclose (messages [w]);
+  free (messages);
+  free (pids);
+  if (shared != MAP_FAILED) munmap (shared, shared_size);
+  munmap (chunks, chunks_size);
+  return ParseLines (Text, Length, 1, Parse, Out);
+}
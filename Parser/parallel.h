@@ -0,0 +1,26 @@
+/* Project:  COCKTAIL training
+ * Descr:    A recursive Decent Parser for expressions
+ * Kind:     Parsing lines of expressions in parallel (interface)
+ */
+
+# ifndef parallel_H
+# define parallel_H
+
+# include <stdio.h>
+# include <stddef.h>
+# include "parser.h"
+
+# define PARALLEL_CHUNK	(64 * 1024)
+/* bytes of input a worker takes at a time, rounded up to a whole line */
+
+extern long ParseParallel (char * Text, size_t Length, bool (* Parse) (void),
+			   int Workers, FILE * Out);
+/* Same as ParseLines (Text, Length, 1, Parse, Out), using `Workers'
+ * processes: each one takes the next chunk of lines not yet taken, until
+ * all are parsed, and the results and the messages are written in the
+ * order of the lines. The lines left by a failed worker are written as
+ * "line not parsed" and counted as errors. Falls back to ParseLines if no
+ * worker can be started.
+ */
+
+# endif
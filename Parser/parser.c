@@ -6,12 +6,20 @@
  */
 
 # include <stdlib.h>
+# include <string.h>
 # include "expr_scan.h"
 # include "parser.h"
+# include "ast.h"
+# include "tokens.h"
 # include "Errors.h"
       	/* contains: `Message', `MessageI', `xxFatal', `xxError' */
 
 tToken CurToken;
+bool   BuildTree = false;
+bool   Recover = false;
+int    SyntaxErrors = 0;
+
+static bool Reported = false;	/* an error was reported, no token matched since */
 
 /*****************************************************************************
  * helpers
@@ -50,6 +58,25 @@ static const char* token2string (tToken token)
   }
 }
 
+/* Reports a syntax error, unless no token was matched since the last one:
+ * then it is a consequence of that one, e.g. the `)' which made <F> fail
+ * is not reported again at the end of the expression.
+ */
+static void SyntaxError (char * msg)
+{
+  if (! Reported) {
+    Message (msg, xxError, expr_scan_Attribute.Position);
+    SyntaxErrors ++;
+  }
+  Reported = true;
+}
+
+void ResetSyntaxErrors (void)
+{
+  SyntaxErrors = 0;
+  Reported = false;
+}
+
 /******************************************************************************/
 
 bool match (tToken token)
@@ -62,15 +89,16 @@ bool match (tToken token)
   printf ("      cur = `%s' expected = `%s'\n", token2string(CurToken), token2string (token));
 # endif
   if (CurToken == token) {
-    if (CurToken != expr_scan_EofToken) CurToken = expr_scan_GetToken();
+    if (CurToken != expr_scan_EofToken) CurToken = NextToken ();
+    Reported = false;
     DEBUG_show ("  new");
     return true;
   } else {
     char msg[255];
     sprintf (msg, "Syntax Error: found: `%s' expected: `%s'",
 	     token2string (CurToken), token2string (token));
-    Message (msg, xxError, expr_scan_Attribute.Position);
-    return false;  /* Syntax Error */
+    SyntaxError (msg);
+    return Recover;  /* Syntax Error, with Recover: as if `token' was there */
   }
 }
 
@@ -202,6 +230,40 @@ static bool FirstFollow_8 (void)
  ******************************************************************************/
 
 
+/* Tree building: the operands are on the node stack (see ast.h).
+ * After a syntax error the stack does not fit the input any more.
+ */
+static bool Leaf (void)
+{
+  if (BuildTree && SyntaxErrors == 0)
+    PushLeaf (MakeIdent (expr_scan_Attribute.identifier.Value,
+			 strlen (expr_scan_Attribute.identifier.Value)));
+  return true;
+}
+
+static bool Binary (int op)
+{
+  if (BuildTree && SyntaxErrors == 0) PushBinary (op);
+  return true;
+}
+
+/* Error recovery (panic mode): reports the error and skips tokens up to
+ * one which can start the nonterminal (FIRST) or follow it (FOLLOW), eof
+ * is in every FOLLOW set. Returns true in the first case, the nonterminal
+ * is parsed again then. Without `Recover' it returns false at once.
+ */
+static bool Sync (char * msg, bool (* first) (void), bool (* follow) (void))
+{
+  SyntaxError (msg);
+  if (! Recover) return false;
+  while (! first () && ! follow ()) CurToken = NextToken ();
+  return first ();
+}
+
+/* FIRST (F) and FOLLOW (F), see the sets of the productions above */
+static bool First_F  (void) { return FirstFollow_7 () || FirstFollow_8 (); }
+static bool Follow_F (void) { return FirstFollow_5 () || FirstFollow_6 (); }
+
 /* we define our Nonterminals */
 static bool f_E1 (void);
 static bool f_T  (void);
@@ -217,18 +279,18 @@ bool f_E (void)
   if (FirstFollow_1()) return f_T() && f_E1();
   
   /* It is not part of our langueage*/
-  Message ("Syntax Error in <E>", xxError, expr_scan_Attribute.Position);
-  return false; /* Syntax Error */
+  if (Sync ("Syntax Error in <E>", FirstFollow_1, FirstFollow_3)) return f_E ();
+  return Recover; /* Syntax Error */
 }
 
 bool f_E1 (void)
 {
   DEBUG_show("E1");
 
-  if (FirstFollow_2()) return match ('+') && f_T() && f_E1();
+  if (FirstFollow_2()) return match ('+') && f_T() && Binary ('+') && f_E1();
   if (FirstFollow_3()) return true;
-  Message ("Syntax Error in <E1>", xxError, expr_scan_Attribute.Position);
-  return false; /* Syntax Error */
+  if (Sync ("Syntax Error in <E1>", FirstFollow_2, FirstFollow_3)) return f_E1 ();
+  return Recover; /* Syntax Error */
 }
 
 bool f_T (void)
@@ -236,18 +298,18 @@ bool f_T (void)
   DEBUG_show("T");
 
   if (FirstFollow_4()) return f_F() && f_T1();
-  Message ("Syntax Error in <T>", xxError, expr_scan_Attribute.Position);
-  return false; /* Syntax Error */
+  if (Sync ("Syntax Error in <T>", FirstFollow_4, FirstFollow_6)) return f_T ();
+  return Recover; /* Syntax Error */
 }
 
 bool f_T1 (void)
 {
   DEBUG_show("T1");
 
-  if (FirstFollow_5()) return match ('*') && f_F() && f_T1();
+  if (FirstFollow_5()) return match ('*') && f_F() && Binary ('*') && f_T1();
   if (FirstFollow_6()) return true;
-  Message ("Syntax Error in <T1>", xxError, expr_scan_Attribute.Position);
-  return false; /* Syntax Error */
+  if (Sync ("Syntax Error in <T1>", FirstFollow_5, FirstFollow_6)) return f_T1 ();
+  return Recover; /* Syntax Error */
 }
 
 bool f_F (void)
@@ -255,7 +317,20 @@ bool f_F (void)
   DEBUG_show("F");
 
   if (FirstFollow_7()) return match ('(') && f_E() && match (')');
-  if (FirstFollow_8()) return match (tok_identifier);
-  Message ("Syntax Error in <F>", xxError, expr_scan_Attribute.Position);
-  return false; /* Syntax Error */
-}
\ No newline at end of file
+  if (FirstFollow_8()) return Leaf () && match (tok_identifier);
+  if (Sync ("Syntax Error in <F>", First_F, Follow_F)) return f_F ();
+  return Recover; /* Syntax Error */
+}
+
+bool f_Input (void)
+{
+  ResetSyntaxErrors ();
+  f_E ();
+  while (CurToken != expr_scan_EofToken) {	/* e.g. a surplus `)' */
+    match (expr_scan_EofToken);
+    do CurToken = NextToken ();
+    while (CurToken != expr_scan_EofToken && ! FirstFollow_1 ());
+    if (CurToken != expr_scan_EofToken) f_E ();
+  }
+  return SyntaxErrors == 0;
+}
@@ -9,6 +9,7 @@
 # define parser_H
 
 # include "expr_scan.h"
+# include "ast.h"
 
 typedef enum {
   false = 0,
@@ -18,6 +19,24 @@ typedef enum {
 extern tToken CurToken;
 /* current analyzed token */
 
+extern bool BuildTree;
+/* if true, the parser builds the abstract syntax tree of the input in the
+ * arena of ast.h: after f_E() succeeded, TopNode() is the root of the tree
+ * of the expression. Call ResetAst() before parsing the next input.
+ */
+
+extern bool Recover;
+/* if true, the parser recovers from syntax errors: it reports the error,
+ * skips the input up to a token which fits again and continues, so that
+ * all errors are reported in one pass. Use it with f_Input() only.
+ */
+
+extern int SyntaxErrors;
+/* number of syntax errors reported */
+
+extern void ResetSyntaxErrors (void);
+/* Sets SyntaxErrors to 0, to be called before a new input is parsed. */
+
 extern bool match (tToken token);
 /* returns true, iff CurToken == token, and reads next token */
 
@@ -28,4 +47,10 @@ extern bool f_E (void);
  * `CurToken' refers to then to the next token.
 */
 
+extern bool f_Input (void);
+/* Parses `E eof' like `f_E() && match (expr_scan_EofToken)'. With `Recover'
+ * it continues after every error, and after surplus tokens at the end of
+ * an expression. Returns true, iff no syntax error was found.
+ */
+
 # endif
@@ -0,0 +1,158 @@
+/* Project:  COCKTAIL training
+ * Descr:    A recursive Decent Parser for expressions
+ * Kind:     Precedence climbing parser
+ *
+ * An expression is a primary followed by infix operators: the operand of
+ * precedence p is a primary and then the operators binding at least as
+ * tight as p, their right operands with the next higher precedence (left
+ * associative) or the same one (right associative). A new operator level
+ * is a line in `operators', e.g. { '-', 1, LEFT, 3 } for binary and unary
+ * minus, once the scanner returns its token.
+ * Instead of recursion, the operators and parentheses still waiting for
+ * their operand are kept on a stack, so the depth of nesting is limited by
+ * memory only.
+ */
+
+# include <string.h>
+# include "expr_scan.h"
+# include "parser.h"
+# include "ast.h"
+# include "DynArray.h"
+# include "Errors.h"
+# include "pratt.h"
+
+typedef enum { LEFT, RIGHT } tAssoc;
+
+typedef struct {
+  tToken Token;
+  int    Infix;		/* precedence as infix operator, 0: none */
+  tAssoc Assoc;
+  int    Prefix;	/* precedence of the operand as prefix operator, 0: none */
+} tOperator;
+
+static const tOperator operators [] = {
+  /* token  infix  assoc  prefix */
+  { '+',    1,     LEFT,  0 },
+  { '*',    2,     LEFT,  0 },
+};
+
+static const tOperator * by_token [256];
+
+static const tOperator * Operator (tToken token)
+{
+  static bool initialized = false;
+  if (! initialized) {
+    unsigned i;
+    for (i = 0; i < sizeof (operators) / sizeof (operators [0]); i ++)
+      by_token [operators [i].Token] = & operators [i];
+    initialized = true;
+  }
+  return token >= 0 && token < 256 ? by_token [token] : NULL;
+}
+
+/* The messages of f_E (): the operand of an operator of precedence p is
+ * the nonterminal of operand_msg [p] there, and T1 is the innermost one
+ * which checks the token behind an operand.
+ */
+static char * operand_msg [] = {
+  NULL, "Syntax Error in <E>", "Syntax Error in <T>", "Syntax Error in <F>",
+};
+# define OPERAND_LEVELS	(sizeof (operand_msg) / sizeof (operand_msg [0]))
+# define REST_MSG	"Syntax Error in <T1>"
+
+/* what waits for the operand on top of the stack */
+typedef enum { INFIX, PREFIX, PAREN } tKind;
+
+typedef struct {
+  tKind  Kind;
+  tToken Token;
+  int    Precedence;	/* of the operand containing it */
+} tEntry;
+
+static tEntry *	     stack = NULL;
+static unsigned long stack_size = 0;
+
+static bool Expression (int precedence)
+{
+  unsigned long depth = 0;
+  const tOperator * op;
+
+  if (stack == NULL) {
+    stack_size = 256;
+    MakeArray ((char * *) & stack, & stack_size, sizeof (tEntry));
+  }
+
+  for (;;) {
+    /* primary: an operand of `precedence' starts, open operators and
+     * parentheses are stacked
+     */
+    for (;;) {
+      tKind kind;
+      op = Operator (CurToken);
+      if (op != NULL && op->Prefix > 0) {
+	kind = PREFIX;
+      } else if (CurToken == '(') {
+	kind = PAREN;
+      } else if (CurToken == tok_identifier) {
+	if (BuildTree)
+	  PushLeaf (MakeIdent (expr_scan_Attribute.identifier.Value,
+			       strlen (expr_scan_Attribute.identifier.Value)));
+	match (tok_identifier);
+	break;
+      } else {
+	Message (operand_msg [precedence < (int) OPERAND_LEVELS ? precedence
+			      : (int) OPERAND_LEVELS - 1],
+		 xxError, expr_scan_Attribute.Position);
+	return false; /* Syntax Error */
+      }
+      if (depth == stack_size)
+	ExtendArray ((char * *) & stack, & stack_size, sizeof (tEntry));
+      stack [depth].Kind = kind;
+      stack [depth].Token = CurToken;
+      stack [depth ++].Precedence = precedence;
+      match (CurToken);
+      precedence = kind == PREFIX ? op->Prefix : 1;
+    }
+
+    /* infix operators binding at least as tight as `precedence', the
+     * operands done are completed
+     */
+    for (;;) {
+      op = Operator (CurToken);
+      if (op != NULL && op->Infix >= precedence) {
+	if (depth == stack_size)
+	  ExtendArray ((char * *) & stack, & stack_size, sizeof (tEntry));
+	stack [depth].Kind = INFIX;
+	stack [depth].Token = CurToken;
+	stack [depth ++].Precedence = precedence;
+	match (CurToken);
+	precedence = op->Assoc == LEFT ? op->Infix + 1 : op->Infix;
+	break;				/* parse the right operand */
+      }
+      if ((op == NULL || op->Infix == 0) && CurToken != ')' &&
+	  CurToken != expr_scan_EofToken) {
+	Message (REST_MSG, xxError, expr_scan_Attribute.Position);
+	return false; /* Syntax Error */
+      }
+      if (depth == 0) return true;
+      depth --;
+      precedence = stack [depth].Precedence;
+      switch (stack [depth].Kind) {
+      case INFIX:
+	if (BuildTree) PushBinary (stack [depth].Token);
+	break;
+      case PREFIX:
+	if (BuildTree) PushUnary (stack [depth].Token);
+	break;
+      case PAREN:
+	if (! match (')')) return false;
+	break;
+      }
+    }
+  }
+}
+
+bool pratt_E (void)
+{
+  return Expression (1);
+}
@@ -0,0 +1,18 @@
+/* Project:  COCKTAIL training
+ * Descr:    A recursive Decent Parser for expressions
+ * Kind:     Precedence climbing parser (interface)
+ */
+
+# ifndef pratt_H
+# define pratt_H
+
+# include "parser.h"
+
+extern bool pratt_E (void);
+/* Same as f_E(), but the operators are taken from an operator table giving
+ * their precedence, associativity and prefix use, so there is no pair of
+ * functions per precedence level. Accepts the same inputs as f_E() and
+ * builds the same tree if `BuildTree' is set.
+ */
+
+# endif
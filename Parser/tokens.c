@@ -0,0 +1,60 @@
+/* Project:  COCKTAIL training
+ * Descr:    A recursive Decent Parser for expressions
+ * Kind:     Ring buffer of tokens between scanner and parser
+ *
+ * Every token is stored with a copy of its attributes, which are restored
+ * when the token is consumed, so the parser sees the position and value of
+ * `CurToken' in `expr_scan_Attribute' even if the scanner is ahead.
+ */
+
+# include "expr_scan.h"
+# include "tokens.h"
+
+typedef struct {
+  tToken		   Token;
+  expr_scan_tScanAttribute Attribute;
+} tTokenRec;
+
+static tTokenRec     ring [TOKEN_RING];
+static unsigned long head = 0;		/* next token to consume */
+static unsigned long tail = 0;		/* next free entry */
+static int	     at_eof = 0;	/* eof is in the ring */
+
+/* Scans until `n' tokens are buffered or eof is reached */
+static void Fill (unsigned long n)
+{
+  while (tail - head < n && ! at_eof) {
+    tTokenRec * r = & ring [tail ++ % TOKEN_RING];
+    r->Token	 = expr_scan_GetToken ();
+    r->Attribute = expr_scan_Attribute;
+    at_eof	 = r->Token == expr_scan_EofToken;
+  }
+}
+
+tToken NextToken (void)
+{
+  tTokenRec * r;
+  if (head == tail) {
+    if (at_eof) return expr_scan_EofToken;
+    Fill (TOKEN_BATCH);
+  }
+  r = & ring [head ++ % TOKEN_RING];
+  expr_scan_Attribute = r->Attribute;
+  return r->Token;
+}
+
+tToken PeekToken (int k)
+{
+  expr_scan_tScanAttribute current = expr_scan_Attribute;
+  if (k < 1 || k > TOKEN_RING) return expr_scan_EofToken;
+  Fill ((unsigned long) k);		/* sets expr_scan_Attribute */
+  expr_scan_Attribute = current;
+  if (tail - head < (unsigned long) k) return expr_scan_EofToken;
+  return ring [(head + k - 1) % TOKEN_RING].Token;
+}
+
+void ResetTokens (void)
+{
+  head = tail = 0;
+  at_eof = 0;
+}
@@ -0,0 +1,28 @@
+/* Project:  COCKTAIL training
+ * Descr:    A recursive Decent Parser for expressions
+ * Kind:     Ring buffer of tokens between scanner and parser (interface)
+ */
+
+# ifndef tokens_H
+# define tokens_H
+
+# include "expr_scan.h"
+
+# define TOKEN_RING	64	/* tokens buffered at most, a power of 2 */
+# define TOKEN_BATCH	16	/* tokens scanned at once */
+
+extern tToken NextToken   (void);
+/* Returns the next token of the input and sets `expr_scan_Attribute' to
+ * its attributes, as expr_scan_GetToken() does. The tokens are scanned in
+ * batches of TOKEN_BATCH, at the end of the input eof is returned again.
+ */
+
+extern tToken PeekToken   (int k);
+/* Returns the k-th token (k = 1 .. TOKEN_RING) behind the one returned
+ * last by NextToken, without consuming it: LL(k) decisions.
+ */
+
+extern void   ResetTokens (void);
+/* Drops the buffered tokens, to be called before a new input is begun. */
+
+# endif
@@ -0,0 +1,177 @@
+/* Project:  COCKTAIL training
+ * Descr:    A recursive Decent Parser for expressions
+ * Kind:     Bytecode and register machine for expressions
+ *
+ * An expression is compiled once into three address code over registers
+ * and then evaluated for any number of bindings without parsing again.
+ */
+
+# include <stdlib.h>
+# include "expr_scan.h"
+# include "DynArray.h"
+# include "vm.h"
+
+/* registers needed to evaluate the nodes, see Need (); wider than a
+ * register number, so CompileAst sees a tree needing too many
+ */
+static unsigned short * need = NULL;
+static unsigned long   need_size = 0;
+
+/* Sethi-Ullman numbers of all nodes. The arena holds the operands of a
+ * node in front of it, so one pass in arena order does it.
+ */
+static void Need (void)
+{
+  tNode n;
+  if (need == NULL) {
+    need_size = AstCount + 1;
+    MakeArray ((char * *) & need, & need_size, sizeof (unsigned short));
+  }
+  while (need_size < (unsigned long) AstCount + 1)
+    ExtendArray ((char * *) & need, & need_size, sizeof (unsigned short));
+  for (n = 1; n <= AstCount; n ++) {
+    if (AstOp (n) == tok_identifier) {
+      need [n] = 1;
+    } else if (AstRight (n) == NoNode) {
+      need [n] = need [AstLeft (n)];
+    } else {
+      int l = need [AstLeft (n)], r = need [AstRight (n)];
+      need [n] = l == r ? l + 1 : l > r ? l : r;
+    }
+  }
+}
+
+static void Emit (tCode * Code, int Op, int Dst, int A, int B, uint32_t Ident)
+{
+  tInstr * i;
+  if (Code->Instr == NULL) {
+    Code->Size = 64;
+    MakeArray ((char * *) & Code->Instr, & Code->Size, sizeof (tInstr));
+  } else if (Code->Count == Code->Size) {
+    ExtendArray ((char * *) & Code->Instr, & Code->Size, sizeof (tInstr));
+  }
+  i = & Code->Instr [Code->Count ++];
+  i->Op = Op; i->Dst = Dst; i->A = A; i->B = B; i->Ident = Ident;
+  if (Dst + 1 > Code->Registers) Code->Registers = Dst + 1;
+}
+
+/* The nodes whose code is being emitted by Gen, with the number of their
+ * operands done
+ */
+typedef struct {
+  tNode Node;
+  int   Reg;
+  int   Done;
+} tGenEntry;
+
+static tGenEntry *   gen_stack = NULL;
+static unsigned long gen_stack_size = 0;
+
+/* Emits the code computing `Root' into register 0. The code of a node goes
+ * into register `Reg', using the registers from `Reg' upwards; its operand
+ * needing more registers first. The nodes are kept on an explicit stack
+ * instead of recursive calls, like in ll1.c, so the depth of the tree is
+ * limited by memory only.
+ */
+static bool Gen (tCode * Code, tNode Root)
+{
+  unsigned long depth = 0;
+
+  if (gen_stack == NULL) {
+    gen_stack_size = 64;
+    MakeArray ((char * *) & gen_stack, & gen_stack_size, sizeof (tGenEntry));
+  }
+  gen_stack [0].Node = Root;
+  gen_stack [0].Reg  = 0;
+  gen_stack [0].Done = 0;
+  depth = 1;
+
+  while (depth > 0) {
+    tGenEntry * e = & gen_stack [depth - 1];
+    tNode node = e->Node, next;
+    int op, reg;
+    bool left_first;
+    switch (AstOp (node)) {
+    case tok_identifier:
+      Emit (Code, OpLoad, e->Reg, 0, 0, AstIdent (node));
+      depth --;
+      continue;
+    case '+': op = OpAdd; break;
+    case '*': op = OpMul; break;
+    default:  return false;
+    }
+    left_first = need [AstLeft (node)] >= need [AstRight (node)];
+    if (e->Done == 2) {
+      Emit (Code, op, e->Reg, left_first ? e->Reg : e->Reg + 1,
+	    left_first ? e->Reg + 1 : e->Reg, 0);
+      depth --;
+      continue;
+    }
+    next = (e->Done == 0) == left_first ? AstLeft (node) : AstRight (node);
+    reg  = e->Reg + e->Done;
+    e->Done ++;
+    if (depth == gen_stack_size)
+      ExtendArray ((char * *) & gen_stack, & gen_stack_size, sizeof (tGenEntry));
+    gen_stack [depth].Node = next;
+    gen_stack [depth].Reg  = reg;
+    gen_stack [depth].Done = 0;
+    depth ++;
+  }
+  return true;
+}
+
+bool CompileAst (tNode Root, tCode * Code)
+{
+  Code->Count = 0;
+  Code->Registers = 0;
+  if (Root == NoNode) return false;
+  Need ();
+  if (need [Root] > MAX_REGISTERS) return false;
+  if (! Gen (Code, Root)) return false;
+  Emit (Code, OpRet, 0, 0, 0, 0);
+  return true;
+}
+
+double Evaluate (const tCode * Code, const double * Bindings)
+{
+  double R [MAX_REGISTERS];
+  const tInstr * i = Code->Instr;
+  for (;; i ++) {
+    switch (i->Op) {
+    case OpLoad: R [i->Dst] = Bindings [i->Ident];     break;
+    case OpAdd:  R [i->Dst] = R [i->A] + R [i->B];     break;
+    case OpMul:  R [i->Dst] = R [i->A] * R [i->B];     break;
+    case OpRet:  return R [i->Dst];
+    }
+  }
+}
+
+void WriteCode (FILE * File, const tCode * Code)
+{
+  unsigned long n;
+  for (n = 0; n < Code->Count; n ++) {
+    const tInstr * i = & Code->Instr [n];
+    switch (i->Op) {
+    case OpLoad:
+      fprintf (File, "%4lu  load  r%d, ", n, i->Dst);
+      WriteIdent (File, (tIdent) i->Ident);
+      fputc ('\n', File);
+      break;
+    case OpAdd:
+      fprintf (File, "%4lu  add   r%d, r%d, r%d\n", n, i->Dst, i->A, i->B); break;
+    case OpMul:
+      fprintf (File, "%4lu  mul   r%d, r%d, r%d\n", n, i->Dst, i->A, i->B); break;
+    case OpRet:
+      fprintf (File, "%4lu  ret   r%d\n", n, i->Dst); break;
+    }
+  }
+}
+
+void ReleaseCode (tCode * Code)
+{
+  if (Code->Instr != NULL)
+    ReleaseArray ((char * *) & Code->Instr, & Code->Size, sizeof (tInstr));
+  Code->Instr = NULL;
+  Code->Count = 0;
+  Code->Registers = 0;
+}
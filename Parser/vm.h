@@ -0,0 +1,49 @@
+/* Project:  COCKTAIL training
+ * Descr:    A recursive Decent Parser for expressions
+ * Kind:     Bytecode and register machine for expressions (interface)
+ */
+
+# ifndef vm_H
+# define vm_H
+
+# include <stdio.h>
+# include <stdint.h>
+# include "ast.h"
+# include "parser.h"
+
+typedef enum {
+  OpLoad,		/* R [Dst] := Bindings [Ident]	*/
+  OpAdd,		/* R [Dst] := R [A] + R [B]	*/
+  OpMul,		/* R [Dst] := R [A] * R [B]	*/
+  OpRet			/* result  := R [Dst]		*/
+} tOpCode;
+
+typedef struct {
+  unsigned char Op, Dst, A, B;
+  uint32_t	Ident;
+} tInstr;
+
+# define MAX_REGISTERS	256
+
+typedef struct {
+  tInstr *	Instr;
+  unsigned long	Count, Size;
+  int		Registers;	/* number of registers used */
+} tCode;
+
+extern bool   CompileAst  (tNode Root, tCode * Code);
+/* Translates the tree `Root' into `Code', which has to be zero initialized
+ * or released before. The registers are allocated by the Sethi-Ullman
+ * numbering, so the number of registers grows with the logarithm of the
+ * size of the tree at most. Returns false for operators unknown to the
+ * machine.
+ */
+
+extern double Evaluate    (const tCode * Code, const double * Bindings);
+/* Executes `Code', the value of identifier `i' is `Bindings [i]'. */
+
+extern void   WriteCode   (FILE * File, const tCode * Code);
+
+extern void   ReleaseCode (tCode * Code);
+
+# endif
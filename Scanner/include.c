@@ -0,0 +1,98 @@
+/* Project:  COCKTAIL training
+ * Descr:    a simple scanner generated with rex
+ * Kind:     process-wide cache of mapped include files
+ */
+
+# include <stdlib.h>
+# include <string.h>
+# include <limits.h>
+# include <fcntl.h>
+# include <unistd.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include "include.h"
+
+# define INIT_CACHE_SIZE 64	/* must be a power of 2 */
+
+typedef struct {
+  char * Path;			/* canonical path, NULL: free slot */
+  char * Text;
+  size_t Length;
+} tCacheEntry;
+
+static tCacheEntry * cache      = NULL;
+static unsigned long cache_size = 0;	/* number of slots */
+static unsigned long cache_used = 0;
+
+static unsigned long Hash (const char * s)
+{
+  unsigned long h = 5381;
+  while (*s) h = h * 33 + (unsigned char) *s ++;
+  return h;
+}
+
+/* Returns the slot of `Path', or the free slot where it has to be entered */
+static tCacheEntry * Lookup (const char * Path)
+{
+  unsigned long i = Hash (Path) & (cache_size - 1);
+  while (cache [i].Path != NULL && strcmp (cache [i].Path, Path) != 0)
+    i = (i + 1) & (cache_size - 1);
+  return & cache [i];
+}
+
+static int Grow (void)
+{
+  tCacheEntry * old = cache;
+  unsigned long old_size = cache_size, i;
+  cache_size = old_size == 0 ? INIT_CACHE_SIZE : 2 * old_size;
+  cache = calloc (cache_size, sizeof (tCacheEntry));
+  if (cache == NULL) { cache = old; cache_size = old_size; return 0; }
+  for (i = 0; i < old_size; i ++)
+    if (old [i].Path != NULL) * Lookup (old [i].Path) = old [i];
+  free (old);
+  return 1;
+}
+
+int MapInclude (char * FileName, char ** Text, size_t * Length)
+{
+  char path [PATH_MAX];
+  tCacheEntry * entry;
+  struct stat st;
+  int fd;
+
+  if (realpath (FileName, path) == NULL) return 0;
+  if (2 * (cache_used + 1) > cache_size && ! Grow ()) return 0;
+  entry = Lookup (path);
+  if (entry->Path == NULL) {		/* first inclusion: map the file */
+    if ((fd = open (path, O_RDONLY)) < 0) return 0;
+    if (fstat (fd, & st) < 0 || ! S_ISREG (st.st_mode) ||
+	(off_t) (size_t) st.st_size != st.st_size) { close (fd); return 0; }
+    if (st.st_size == 0) {
+      entry->Text = "";
+    } else {
+      entry->Text = mmap (NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (entry->Text == MAP_FAILED) { close (fd); return 0; }
+    }
+    close (fd);
+    entry->Length = (size_t) st.st_size;
+    entry->Path   = strdup (path);
+    cache_used ++;
+  }
+  * Text   = entry->Text;
+  * Length = entry->Length;
+  return 1;
+}
+
+void ReleaseIncludes (void)
+{
+  unsigned long i;
+  for (i = 0; i < cache_size; i ++)
+    if (cache [i].Path != NULL) {
+      if (cache [i].Length > 0) munmap (cache [i].Text, cache [i].Length);
+      free (cache [i].Path);
+    }
+  free (cache);
+  cache      = NULL;
+  cache_size = 0;
+  cache_used = 0;
+}
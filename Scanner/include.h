@@ -0,0 +1,22 @@
+/* Project:  COCKTAIL training
+ * Descr:    a simple scanner generated with rex
+ * Kind:     process-wide cache of mapped include files (interface)
+ */
+
+# ifndef include_H
+# define include_H
+
+# include <stddef.h>
+
+extern int MapInclude (char * FileName, char ** Text, size_t * Length);
+/* Returns in `*Text' and `*Length' the contents of the file `FileName'.
+ * Every file is mapped into memory only once per run, no matter how often
+ * and from how many files it is included; files are identified by their
+ * canonical path. The contents stay valid until ReleaseIncludes is called.
+ * Returns 0, if the file can not be read or is no regular file, 1 otherwise.
+ */
+
+extern void ReleaseIncludes (void);
+/* Unmaps all files mapped by MapInclude. */
+
+# endif
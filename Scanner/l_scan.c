@@ -48,16 +48,20 @@ EXTERN_C_END
 # define yyFirstCh	(yytusChar) '\0'
 # define yyEolCh	(yytusChar) '\12'
 # define yyEobCh	(yytusChar) '\177'
-# define yyDStateCount	43
-# define yyTableSize	683
-# define yyEobState	23
-# define yyDefaultState	24
+# define yyDStateCount	57
+# define yyTableSize	1266
+# define yyEobState	43
+# define yyDefaultState	44
 # define yyToClassArraySize	0
 # define STD	1
 # define STR	3
 # define COM	5
+# define LCOM	7
+# define TRIV	9
+# define yyLastAccept
 # define xxGetWord
 # define xxinput
+# define xxyyPush
 
 static void yyExit ARGS ((void))
 { rExit (1); }
@@ -78,112 +82,214 @@ static	void		yyLess		ARGS ((int));
 
 static	yyCombType	yyComb		[yyTableSize   + 1] = {
 {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, 
-{   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, {   1,   26}, 
-{   1,   25}, {   0,    0}, {   0,    0}, {   3,   26}, {   3,   28}, 
+{   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, {   1,   48}, 
+{   1,   45}, {   0,    0}, {   0,    0}, {   9,   22}, {   9,   22}, 
+{  22,   22}, {  22,   22}, {   0,    0}, {   0,    0}, {   0,    0}, 
+{   0,    0}, {  37,   38}, {   0,    0}, {   0,    0}, {   0,    0}, 
 {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, 
+{   0,    0}, {   0,    0}, {   1,   49}, {   0,    0}, {   1,   52}, 
+{   1,   11}, {   9,   22}, {  20,   57}, {  22,   22}, {  38,   39}, 
+{   1,   55}, {  19,   54}, {   1,   12}, {   1,   12}, {  37,   38}, 
+{   1,   12}, {   1,   13}, {   1,   12}, {   1,   14}, {   1,   14}, 
+{   1,   14}, {   1,   14}, {   1,   14}, {   1,   14}, {   1,   14}, 
+{   1,   14}, {   1,   14}, {   1,   14}, {  25,   28}, {  40,   41}, 
+{  25,   28}, {  50,   51}, {  55,   56}, {   0,    0}, {   0,    0}, 
+{   0,    0}, {   1,   16}, {  13,   24}, {  13,   24}, {  13,   24}, 
+{  13,   24}, {  13,   24}, {  13,   24}, {  13,   24}, {  13,   24}, 
+{  13,   24}, {  13,   24}, {  14,   13}, {  24,   25}, {  14,   14}, 
+{  14,   14}, {  14,   14}, {  14,   14}, {  14,   14}, {  14,   14}, 
+{  14,   14}, {  14,   14}, {  14,   14}, {  14,   14}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   1,   16}, {   3,   46}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {  11,   23}, {   3,   17}, {   3,   53}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   50}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {  23,   27}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, {   3,   17}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{  27,   31}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   19}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   20}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {  31,   33}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, {   5,   18}, 
+{   5,   18}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   47}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {  33,   35}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, {   7,   21}, 
+{   7,   21}, {   7,   21}, {  15,   15}, {  15,   15}, {  15,   15}, 
+{  15,   15}, {  15,   15}, {  15,   15}, {  15,   15}, {  15,   15}, 
+{  15,   15}, {  15,   15}, {  35,   36}, {  16,   26}, {  26,   30}, 
+{  30,   32}, {  32,   34}, {  36,   37}, {  42,   43}, {  15,   15}, 
+{  15,   15}, {  15,   15}, {  15,   15}, {  15,   15}, {  15,   15}, 
+{  15,   15}, {  15,   15}, {  15,   15}, {  15,   15}, {  15,   15}, 
+{  15,   15}, {  15,   15}, {  15,   15}, {  15,   15}, {  15,   15}, 
+{  15,   15}, {  15,   15}, {  15,   15}, {  15,   15}, {  15,   15}, 
+{  15,   15}, {  15,   15}, {  15,   15}, {  15,   15}, {  15,   15}, 
+{  16,   26}, {  26,   30}, {  30,   32}, {  32,   34}, {   0,    0}, 
+{   0,    0}, {  15,   15}, {  15,   15}, {  15,   15}, {  15,   15}, 
+{  15,   15}, {  15,   15}, {  15,   15}, {  15,   15}, {  15,   15}, 
+{  15,   15}, {  15,   15}, {  15,   15}, {  15,   15}, {  15,   15}, 
+{  15,   15}, {  15,   15}, {  15,   15}, {  15,   15}, {  15,   15}, 
+{  15,   15}, {  15,   15}, {  15,   15}, {  15,   15}, {  15,   15}, 
+{  15,   15}, {  15,   15}, {  28,   29}, {  28,   29}, {  28,   29}, 
+{  28,   29}, {  28,   29}, {  28,   29}, {  28,   29}, {  28,   29}, 
+{  28,   29}, {  28,   29}, {  39,   40}, {  39,   40}, {  39,   40}, 
+{  39,   40}, {  39,   40}, {  39,   40}, {  39,   40}, {  39,   40}, 
+{  39,   40}, {  39,   40}, {  39,   40}, {  39,   40}, {  39,   40}, 
 {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, 
+{   0,    0}, {   0,    0}, {  39,   40}, {  39,   40}, {  39,   40}, 
+{  39,   40}, {  39,   40}, {  39,   40}, {  39,   40}, {  39,   40}, 
+{  39,   40}, {  39,   40}, {  39,   40}, {  39,   40}, {  39,   40}, 
+{  39,   40}, {  39,   40}, {  39,   40}, {  39,   40}, {  39,   40}, 
+{  39,   40}, {  39,   40}, {  39,   40}, {  39,   40}, {  39,   40}, 
+{  39,   40}, {  39,   40}, {  39,   40}, {   0,    0}, {   0,    0}, 
+{   0,    0}, {   0,    0}, {  39,   40}, {   0,    0}, {  39,   40}, 
+{  39,   40}, {  39,   40}, {  39,   40}, {  39,   40}, {  39,   40}, 
+{  39,   40}, {  39,   40}, {  39,   40}, {  39,   40}, {  39,   40}, 
+{  39,   40}, {  39,   40}, {  39,   40}, {  39,   40}, {  39,   40}, 
+{  39,   40}, {  39,   40}, {  39,   40}, {  39,   40}, {  39,   40}, 
+{  39,   40}, {  39,   40}, {  39,   40}, {  39,   40}, {  39,   40}, 
+{  41,   41}, {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, 
 {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, 
-{   0,    0}, {   0,    0}, {   1,   27}, {   0,    0}, {   1,   32}, 
-{   1,   10}, {   3,   27}, {   0,    0}, {   3,   31}, {   0,    0}, 
-{   1,   42}, {   0,    0}, {   1,   11}, {   1,   11}, {   0,    0}, 
-{   1,   11}, {   1,   12}, {   1,   11}, {   1,    8}, {   1,    8}, 
-{   1,    8}, {   1,    8}, {   1,    8}, {   1,    8}, {   1,    8}, 
-{   1,    8}, {   1,    8}, {   1,    8}, {   5,   26}, {   5,   25}, 
-{  16,   21}, {   0,    0}, {  16,   21}, {   0,    0}, {   0,    0}, 
-{   8,   12}, {   1,   20}, {   8,    8}, {   8,    8}, {   8,    8}, 
-{   8,    8}, {   8,    8}, {   8,    8}, {   8,    8}, {   8,    8}, 
-{   8,    8}, {   8,    8}, {  17,   16}, {   9,   14}, {  15,   18}, 
-{   0,    0}, {   5,   27}, {   0,    0}, {   0,    0}, {   5,   40}, 
-{   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, {   5,   42}, 
-{  18,    9}, {  20,   15}, {   0,    0}, {   0,    0}, {   0,    0}, 
-{   0,    0}, {   3,   29}, {   0,    0}, {   1,   20}, {  12,   17}, 
-{  12,   17}, {  12,   17}, {  12,   17}, {  12,   17}, {  12,   17}, 
-{  12,   17}, {  12,   17}, {  12,   17}, {  12,   17}, {   0,    0}, 
-{   9,   14}, {  15,   18}, {   7,    7}, {   7,    7}, {   7,    7}, 
-{   7,    7}, {   7,    7}, {   7,    7}, {   7,    7}, {   7,    7}, 
-{   7,    7}, {   7,    7}, {  18,    9}, {  20,   15}, {   0,    0}, 
-{   0,    0}, {   0,    0}, {  22,   23}, {  29,   30}, {   7,    7}, 
-{   7,    7}, {   7,    7}, {   7,    7}, {   7,    7}, {   7,    7}, 
-{   7,    7}, {   7,    7}, {   7,    7}, {   7,    7}, {   7,    7}, 
-{   7,    7}, {   7,    7}, {   7,    7}, {   7,    7}, {   7,    7}, 
-{   7,    7}, {   7,    7}, {   7,    7}, {   7,    7}, {   7,    7}, 
-{   7,    7}, {   7,    7}, {   7,    7}, {   7,    7}, {   7,    7}, 
-{  33,   34}, {  34,   35}, {  35,   36}, {  36,   37}, {  37,   38}, 
-{   5,   33}, {   7,    7}, {   7,    7}, {   7,    7}, {   7,    7}, 
-{   7,    7}, {   7,    7}, {   7,    7}, {   7,    7}, {   7,    7}, 
-{   7,    7}, {   7,    7}, {   7,    7}, {   7,    7}, {   7,    7}, 
-{   7,    7}, {   7,    7}, {   7,    7}, {   7,    7}, {   7,    7}, 
-{   7,    7}, {   7,    7}, {   7,    7}, {   7,    7}, {   7,    7}, 
-{   7,    7}, {   7,    7}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  38,   39}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  40,   41}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, {  10,   10}, 
-{  10,   10}, {  10,   10}, {  10,   10}, {  13,   13}, {  13,   13}, 
-{  13,   13}, {  13,   13}, {  13,   13}, {  13,   13}, {  13,   13}, 
-{  13,   13}, {  13,   13}, {  13,   13}, {  19,   19}, {  19,   19}, 
-{  19,   19}, {  19,   19}, {  19,   19}, {  19,   19}, {  19,   19}, 
-{  19,   19}, {  19,   19}, {  19,   19}, {  42,   43}, {   0,    0}, 
 {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, 
-{  19,   19}, {  19,   19}, {  19,   19}, {  19,   19}, {  19,   19}, 
-{  19,   19}, {  19,   19}, {  19,   19}, {  19,   19}, {  19,   19}, 
-{  19,   19}, {  19,   19}, {  19,   19}, {  19,   19}, {  19,   19}, 
-{  19,   19}, {  19,   19}, {  19,   19}, {  19,   19}, {  19,   19}, 
-{  19,   19}, {  19,   19}, {  19,   19}, {  19,   19}, {  19,   19}, 
-{  19,   19}, {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, 
-{   0,    0}, {   0,    0}, {  19,   19}, {  19,   19}, {  19,   19}, 
-{  19,   19}, {  19,   19}, {  19,   19}, {  19,   19}, {  19,   19}, 
-{  19,   19}, {  19,   19}, {  19,   19}, {  19,   19}, {  19,   19}, 
-{  19,   19}, {  19,   19}, {  19,   19}, {  19,   19}, {  19,   19}, 
-{  19,   19}, {  19,   19}, {  19,   19}, {  19,   19}, {  19,   19}, 
-{  19,   19}, {  19,   19}, {  19,   19}, {   0,    0}, {   0,    0}, 
 {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, 
+{   0,    0}, {   0,    0}, {   0,    0}, {  41,   41}, {   0,    0}, 
 {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, 
 {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, 
 {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, 
@@ -213,34 +319,60 @@ static	yyCombType	yyComb		[yyTableSize   + 1] = {
 {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, 
 {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, 
 {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, 
-{   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, 
+{   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, 
+{   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, 
+{   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, 
+{   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, 
+{   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, 
+{   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, 
+{   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, 
+{   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, 
+{   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, 
+{   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, 
+{   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, 
+{   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, 
+{   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, 
+{   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, 
+{   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, {   0,    0}, 
+{   0,    0}, {   0,    0}, 
 };
 static	yyCombType *	yyBasePtr	[yyDStateCount + 1] = { 0,
-& yyComb [   0], & yyComb [   0], & yyComb [   4], & yyComb [   0], 
-& yyComb [  49], & yyComb [   0], & yyComb [  64], & yyComb [  19], 
-& yyComb [   0], & yyComb [ 187], & yyComb [   0], & yyComb [  51], 
-& yyComb [ 395], & yyComb [   0], & yyComb [   8], & yyComb [  17], 
-& yyComb [   8], & yyComb [  17], & yyComb [ 405], & yyComb [  22], 
-& yyComb [   0], & yyComb [   0], & yyComb [   0], & yyComb [   0], 
+& yyComb [   0], & yyComb [   0], & yyComb [  89], & yyComb [   0], 
+& yyComb [ 345], & yyComb [   0], & yyComb [ 601], & yyComb [   0], 
+& yyComb [   4], & yyComb [   0], & yyComb [  16], & yyComb [   0], 
+& yyComb [  19], & yyComb [  31], & yyComb [ 809], & yyComb [ 799], 
+& yyComb [   0], & yyComb [   0], & yyComb [   0], & yyComb [   2], 
+& yyComb [   0], & yyComb [   6], & yyComb [ 106], & yyComb [   9], 
+& yyComb [  15], & yyComb [ 798], & yyComb [ 256], & yyComb [ 884], 
+& yyComb [   0], & yyComb [ 797], & yyComb [ 364], & yyComb [ 793], 
+& yyComb [ 611], & yyComb [   0], & yyComb [ 767], & yyComb [ 771], 
+& yyComb [  12], & yyComb [   5], & yyComb [ 897], & yyComb [  25], 
+& yyComb [1011], & yyComb [ 746], & yyComb [   0], & yyComb [   0], 
 & yyComb [   0], & yyComb [   0], & yyComb [   0], & yyComb [   0], 
-& yyComb [  94], & yyComb [   0], & yyComb [   0], & yyComb [   0], 
-& yyComb [  38], & yyComb [  42], & yyComb [  38], & yyComb [  47], 
-& yyComb [  45], & yyComb [  97], & yyComb [   0], & yyComb [ 273], 
-& yyComb [   0], & yyComb [ 428], & yyComb [   0], 
+& yyComb [   0], & yyComb [  27], & yyComb [   0], & yyComb [   0], 
+& yyComb [   0], & yyComb [   0], & yyComb [  27], & yyComb [   0], 
+& yyComb [   0], 
 };
 static	yyStateRange	yyDefault	[yyDStateCount + 1] = { 0,
-   19,     1,     7,     3,    22,     5,    22,    17,    19,    22, 
-    0,    22,    22,    19,    19,    13,    12,    19,    22,    19, 
-   13,     0,     0,     0,    22,     0,     0,    25,    22,     0, 
-    0,     0,    22,    22,    22,    22,    22,    22,     0,    22, 
-    0,    22,     0, 
+   15,     1,     1,     3,     1,     5,     1,     7,     1,     9, 
+   42,     0,    42,    24,    11,    15,     0,     0,    42,    42, 
+    0,    37,    42,    13,    28,    15,    42,    13,    28,    15, 
+   42,    15,    42,    15,    42,    42,    42,    37,    11,    39, 
+   37,     0,     0,     0,     0,     0,     0,     0,     0,    42, 
+    0,     0,     0,     0,    20,     0,     0, 
 };
 static	yyStateRange	yyEobTrans	[yyDStateCount + 1] = { 0,
-    0,     0,     0,     0,     0,     0,     0,     0,     0,    10, 
+    0,     0,    17,    17,    18,    18,    21,    21,     0,     0, 
     0,     0,     0,     0,     0,     0,     0,     0,     0,     0, 
     0,     0,     0,     0,     0,     0,     0,     0,     0,     0, 
     0,     0,     0,     0,     0,     0,     0,     0,     0,     0, 
-    0,     0,     0, 
+    0,     0,     0,     0,     0,     0,     0,     0,     0,     0, 
+    0,     0,     0,     0,     0,     0,     0, 
+};
+static	rbool		yyFinal		[yyDStateCount + 1] = { 0,
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 
+1, 1, 0, 1, 0, 1, 0, 0, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 
+1, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 
 };
 
 # if l_scan_xxMaxCharacter < 256
@@ -351,12 +483,812 @@ static void yyTab1	ARGS ((int yya));
 # define yyTab		yyTab1 (0)
 # define yyTab2(a,b)	yyTab1 (a)
 
-/* line 56 "l.rex" */
+/* line 186 "l.rex" */
 
   # include <stdlib.h>
+  # include <limits.h>
+  # include <sys/types.h>
+  # include <unistd.h>
   # include "rString.h"
+  # include "skip.h"
+  # include "include.h"
+
+  # define MAX_INCLUDE_DEPTH 200	/* guards against recursive includes, the
+					 * Source module stacks up to 255 inputs */
+
+  /* The input buffer has a fixed size: comments and strings are scanned in
+   * bulk, so no token of this scanner comes close to it and the buffer is
+   * never extended. A refill only moves the few bytes of the current token
+   * to the front of the buffer.
+   */
+  # ifndef yyInitBufferSize
+  # define yyInitBufferSize	1024 * 64 + 256
+  # endif
+
+  /* An include file is copied into a buffer of its own, which is not bigger
+   * than needed for it.
+   */
+  static const unsigned long max_buffer_size = yyInitBufferSize;
+  static unsigned long	     buffer_size     = yyInitBufferSize;  /* of the next input */
+
+  # undef  yyInitBufferSize
+  # define yyInitBufferSize	buffer_size
+
+  /* The hard limit for pathological tokens: the frame extends the buffer as
+   * long as the current token does not fit. ReadSource reads no more than
+   * the limit for the token in front of `Buffer' and then nothing, so the
+   * frame ends the token at the end of the buffer, and yySetPosition skips
+   * it (see TOKEN_TOO_LONG).
+   */
+  static unsigned long buffer_limit    = 16L * 1024 * 1024;
+  static rbool	       buffer_overflow = rfalse;
+
+  void l_scan_SetBufferLimit (unsigned long Size) { buffer_limit = Size; }
+
+  /* The frame counts offsets in long (yyOffset), which has only 32 bits on
+   * some systems. ReadSource counts them in 64 bits, per input.
+   */
+  static l_scan_tOffset source_offset = 0;	/* of the block read last */
+  static l_scan_tOffset next_offset   = 0;	/* of the block read next */
+
+  /* The current input, if it is a block of bytes in memory: ReadSource reads
+   * it itself, so its length is not limited to the range of int. The offsets
+   * are relative to it, so the values can point into it (see VIEW).
+   */
+  static char *	window	      = NULL;
+  static size_t	window_length = 0;
+
+  static int ReadSource (int File, yytChar * Buffer, int Size)
+  {
+    int n;
+    source_offset = next_offset;
+    if (buffer_limit != 0) {
+      unsigned long token = (unsigned long) (Buffer - l_scan_TokenPtr);
+      if (token >= buffer_limit) {
+	buffer_overflow = rtrue;
+	return 0;
+      }
+      if ((unsigned long) Size > buffer_limit - token)
+	Size = (int) (buffer_limit - token);
+    }
+    if (window != NULL) {
+      size_t rest = window_length - (size_t) next_offset;
+      n = rest < (size_t) Size ? (int) rest : Size;
+      memcpy (Buffer, window + next_offset, n);
+    } else {
+      n = yyGetLine (File, Buffer, Size);
+    }
+    if (n > 0) next_offset += n;
+    return n;
+  }
+
+  # undef  yyGetLine
+  # define yyGetLine ReadSource
+
+  /* A too long token is reported once and skipped: TOKEN_TOO_LONG drops
+   * the text in the buffer and lets the automaton continue behind it, in
+   * its state at the end of the buffer, as if the token went on. When the
+   * token ends, yySetPosition is reached again and END_TOO_LONG returns all
+   * of it as tok_illegal_const. This needs the state at the end of the
+   * buffer, which only the last final state mode of minirex (-a) keeps.
+   */
+  # ifndef yyLastAccept
+  # error "l.rex needs a scanner generated by minirex -a"
+  # endif
+
+  static l_scan_tOffset too_long = -1;	/* its length so far, -1: none */
+  static tPosition      too_long_position;
+  static l_scan_tOffset too_long_offset;
+
+  # define TOKEN_TOO_LONG { \
+     buffer_overflow = rfalse; \
+     yyEof = rfalse; \
+     if (too_long < 0) { \
+	too_long = 0; \
+	too_long_position = l_scan_Attribute.Position; \
+	too_long_offset = l_scan_TokenOffset; \
+	Message ("Token too long, skipped", xxError, l_scan_Attribute.Position); \
+     } \
+     yyChBufferIndexReg = & yyChBufferStart [yyBytesRead]; \
+     too_long += yyChBufferIndexReg - (yytusChar *) l_scan_TokenPtr; \
+     l_scan_TokenPtr = (yytChar *) yyChBufferIndexReg; \
+     yyLastIndex = yyChBufferIndexReg; \
+     goto yyContinue; \
+  }
+
+  # define END_TOO_LONG { \
+     l_scan_Attribute.Position = too_long_position; \
+     l_scan_TokenOffset = too_long_offset; \
+     l_scan_Attribute.illegal_const.Count = \
+	too_long + l_scan_TokenLength > INT_MAX ? INT_MAX : \
+	(int) (too_long + l_scan_TokenLength); \
+     too_long = -1; \
+     return tok_illegal_const; \
+  }
+
+  static l_scan_tChunkHandler chunk_handler [l_scan_MaxToken + 1];
+  static void *		      chunk_data    [l_scan_MaxToken + 1];
+
+  int l_scan_SetChunkHandler (int Token, l_scan_tChunkHandler Handler,
+			      void * Data)
+  {
+    if (Token <= l_scan_EofToken || Token > l_scan_MaxToken) return 0;
+    chunk_handler [Token] = Handler;
+    chunk_data    [Token] = Data;
+    return 1;
+  }
+
+  static int return_illegal = 0;
+  static int error_budget   = 0;
+  static int illegal_runs   = 0;
+
+  void l_scan_SetIllegalToken (int Return) { return_illegal = Return; }
+  void l_scan_SetErrorBudget  (int Budget) { error_budget   = Budget; }
+
+  /* A run which reaches the end of the buffer may continue behind it: it is
+   * reported when its end is known, by DEFAULT or by yySetPosition.
+   */
+  static int		illegal_pending = 0;	/* length of that run */
+  static char		illegal_first;
+  static tPosition	illegal_position;
+  static l_scan_tOffset	illegal_end;		/* offset behind that run */
+
+  /* Returns the end of the run of characters starting at `Ptr', which cannot
+   * start any token (in start state STD resp. TRIV, the only ones without a
+   * catch-all).
+   * A "." or "(" in front of `End' ends the run, it may start a token.
+   */
+  static yytusChar * SkipIllegal (yytusChar * Ptr, yytusChar * End)
+  {
+    for (; Ptr < End; Ptr ++) {
+      switch (* Ptr) {
+      case ' ': case '\t': case '\n': case '"': case '#':
+      case '+': case '-': case '*': case '/':
+	return Ptr;
+      case '.':
+	if (Ptr + 1 == End || ('0' <= Ptr [1] && Ptr [1] <= '9')) return Ptr;
+	break;
+      case '(':
+	if (Ptr + 1 == End || Ptr [1] == '#') return Ptr;
+	break;
+      default:
+	if (('a' <= * Ptr && * Ptr <= 'z') || ('A' <= * Ptr && * Ptr <= 'Z') ||
+	    ('0' <= * Ptr && * Ptr <= '9'))
+	  return Ptr;
+      }
+    }
+    return End;
+  }
+
+  /* Report the run of `Length' illegal characters at `Position' */
+  static void ReportIllegal (tPosition Position, int Length, char First)
+  {
+    if (Length == 1) {
+      MessageI ("Panic! Illegal character", xxError, Position, xxCharacter, & First);
+    } else {
+      char msg [80];
+      sprintf (msg, "Panic! %d illegal characters in columns %d-%d", Length,
+	       (int) Position.Column, (int) Position.Column + Length - 1);
+      Message (msg, xxError, Position);
+    }
+    if (error_budget > 0 && ++ illegal_runs >= error_budget) {
+      Message ("Panic! Too many illegal characters, giving up", xxFatal, Position);
+      l_scan_Exit ();
+    }
+  }
+
+  /* Report the pending run, unless DEFAULT continues it with the current
+   * token (yyLastState is the final state whose action is executed,
+   * yyDefaultState in DEFAULT). If it is returned, the current token is
+   * scanned again.
+   */
+  # define FLUSH_ILLEGAL \
+     if (illegal_pending > 0 && \
+	 (yyLastState != yyDefaultState || l_scan_TokenOffset != illegal_end)) { \
+	int length = illegal_pending; \
+	illegal_pending = 0; \
+	ReportIllegal (illegal_position, length, illegal_first); \
+	if (return_illegal) { \
+	   yyChBufferIndex = (yytusChar *) l_scan_TokenPtr; \
+	   l_scan_TokenLength = 0; \
+	   l_scan_Attribute.Position = illegal_position; \
+	   l_scan_Attribute.illegal_const.Count = length; \
+	   return tok_illegal_const; \
+	} \
+     }
+
+  /* The offset of `Ptr' in the current input, see ReadSource */
+  # define OFFSET(Ptr) \
+     (source_offset + ((yytChar *) (Ptr) - yyChBufferStart2))
+
+  l_scan_tOffset l_scan_TokenOffset;
+
+  # ifndef yySetPosition
+  # define yySetPosition l_scan_Attribute.Position.Line = yyLineCount; \
+     l_scan_Attribute.Position.Column = (int) ((yytusChar *) l_scan_TokenPtr - yyLineStart); \
+     l_scan_TokenOffset = OFFSET (l_scan_TokenPtr); \
+     FLUSH_ILLEGAL \
+     if (buffer_overflow) TOKEN_TOO_LONG \
+     if (too_long >= 0) END_TOO_LONG
+  # endif
+
+
+  static int		  trivia_mode  = l_scan_TriviaToken;
+  static l_scan_tTrivia * trivia;
+  static unsigned long	  trivia_size  = 0;
+  static int		  trivia_count = 0;
+  static l_scan_tOffset	  trivia_start;		/* offset of the current comment */
+  static int		  trivia_source;	/* source of the current comment */
+
+  /* The sources begun so far, with the names of their files */
+  static char * *	  source_names	    = NULL;
+  static unsigned long	  source_names_size = 0;
+  static int		  source_count	    = 0;
+  static int		  source	    = 0;	/* the current one */
+
+  char * l_scan_SourceName (int Source)
+  {
+    return 0 <= Source && Source < source_count ? source_names [Source] : NULL;
+  }
+
+  /* Only mode l_scan_TriviaKeep needs the rules for white space, which
+   * replace the builtin actions: its rules are those of STD plus these,
+   * in start state TRIV. STD_STATE is the one to use instead of STD.
+   */
+  # define STD_STATE	(trivia_mode == l_scan_TriviaKeep ? TRIV : STD)
+
+  static void SetStdState (void)
+  {
+    if (yyStartState    == STD || yyStartState    == TRIV) yyStartState    = STD_STATE;
+    if (yyPreviousStart == STD || yyPreviousStart == TRIV) yyPreviousStart = STD_STATE;
+  }
+
+  void l_scan_SetTriviaMode (int Mode)
+  {
+    trivia_mode = Mode;
+    SetStdState ();
+  }
+
+  int l_scan_Trivia (l_scan_tTrivia ** Trivia)
+  {
+    * Trivia = trivia;
+    return trivia_count;
+  }
+
+  static void AddTrivia (int Source, l_scan_tOffset Offset, l_scan_tOffset Length)
+  {
+    if ((unsigned long) trivia_count == trivia_size) {
+      if (trivia_size == 0) {
+	trivia_size = 16;
+	MakeArray ((char * *) & trivia, & trivia_size,
+		   (unsigned long) sizeof (l_scan_tTrivia));
+      } else {
+	ExtendArray ((char * *) & trivia, & trivia_size,
+		     (unsigned long) sizeof (l_scan_tTrivia));
+      }
+      if (trivia == NULL) yyErrorMessage (xxScannerOutOfMemory);
+    }
+    trivia [trivia_count].Source = Source;
+    trivia [trivia_count].Offset = Offset;
+    trivia [trivia_count].Length = Length;
+    trivia_count ++;
+  }
+
+  /* Record the white space at `Ptr' resp. the comment ending at `Ptr' */
+  # define TRIVIA(Ptr, Length) { \
+     if (trivia_mode == l_scan_TriviaKeep) AddTrivia (source, OFFSET (Ptr), Length); \
+  }
+  # define COMMENT_START(Ptr)	{ trivia_start = OFFSET (Ptr); trivia_source = source; }
+  # define COMMENT_END(Ptr)	COMMENT_END_AT (OFFSET (Ptr))
+  # define COMMENT_END_AT(Offset) { \
+     if (trivia_mode == l_scan_TriviaKeep) \
+	AddTrivia (trivia_source, trivia_start, (Offset) - trivia_start); \
+  }
+
+  /* The pool for the values of tokens which are not read from memory */
+  # define VIEW_BLOCK_SIZE	(64L * 1024)
+
+  typedef struct tViewBlock {
+    struct tViewBlock *	Next;
+    char *		Top;
+    char *		End;
+  } tViewBlock;
+
+  static tViewBlock * view_blocks = NULL;
+
+  static char * PoolCopy (char * Ptr, int Length)
+  {
+    char * copy;
+    if (view_blocks == NULL || view_blocks->End - view_blocks->Top < Length + 1) {
+      long size = Length + 1 > VIEW_BLOCK_SIZE ? Length + 1 : VIEW_BLOCK_SIZE;
+      tViewBlock * block = (tViewBlock *) malloc (sizeof (tViewBlock) + size);
+      if (block == NULL) yyErrorMessage (xxScannerOutOfMemory);
+      block->Top  = (char *) (block + 1);
+      block->End  = block->Top + size;
+      block->Next = view_blocks;
+      view_blocks = block;
+    }
+    copy = view_blocks->Top;
+    memcpy (copy, Ptr, Length);
+    copy [Length] = '\0';
+    view_blocks->Top += Length + 1;
+    return copy;
+  }
+
+  void l_scan_ReleaseViews (void)
+  {
+    while (view_blocks != NULL) {
+      tViewBlock * next = view_blocks->Next;
+      free (view_blocks);
+      view_blocks = next;
+    }
+  }
+
+  char * l_scan_Materialize (l_scan_tView View)
+  {
+    char * copy = malloc (View.Length + 1);
+    if (copy == NULL) yyErrorMessage (xxScannerOutOfMemory);
+    memcpy (copy, View.Ptr, View.Length);
+    copy [View.Length] = '\0';
+    return copy;
+  }
+
+  /* The current token as value */
+  # define VIEW(Value) { \
+     (Value).Length = l_scan_TokenLength; \
+     (Value).Ptr = window != NULL ? window + OFFSET (l_scan_TokenPtr) \
+		 : PoolCopy (l_scan_TokenPtr, l_scan_TokenLength); \
+  }
+
+  /* Pass a chunk of the lexeme to the handler of `Token', if any */
+  # define EMIT_CHUNK(Token, Ptr, Length, Last) { \
+     if (chunk_handler [Token] != NULL) \
+	chunk_handler [Token] (Token, (char *) (Ptr), (int) (Length), \
+			       Last, chunk_data [Token]); \
+  }
+
+  /* Skip the body of a nested comment in bulk, up to the closing "#)" or up
+   * to the end of the current buffer. In the latter case we stay in COM and
+   * the scanner continues after refilling the buffer.
+   * The body starts at `From', which is in front of yyChBufferIndex, if the
+   * current token belongs to the body.
+   */
+  # define SKIP_COMMENT(From) { \
+     yytusChar * from = (yytusChar *) (From); \
+     if (nestingCount > 0) \
+	yyChBufferIndex = SkipNestedComment (yyChBufferIndex, \
+	   & yyChBufferStart [yyBytesRead], & nestingCount, \
+	   & yyLineCount, & yyLineStart, yyTabSpace); \
+     if (nestingCount == 0) { \
+	yyStart (STD_STATE); \
+	if (yyChBufferIndex - from >= 2) \
+	   EMIT_CHUNK (tok_comment_const, from, yyChBufferIndex - from - 2, 0); \
+	EMIT_CHUNK (tok_comment_const, yyChBufferIndex, 0, 1); \
+	COMMENT_END (yyChBufferIndex); \
+     } else { \
+	EMIT_CHUNK (tok_comment_const, from, yyChBufferIndex - from, 0); \
+     } \
+  }
+
+  /* Skip a comment up to end of line in bulk, so the body is streamed like
+   * the other comments and a long line never has to fit into the buffer.
+   * If the buffer ends before the line, we continue in LCOM after refilling
+   * the buffer.
+   */
+  # define SKIP_LINE(From) { \
+     yytusChar * from = (yytusChar *) (From); \
+     yyChBufferIndex = SkipToEol (yyChBufferIndex, \
+	& yyChBufferStart [yyBytesRead]); \
+     if (yyChBufferIndex == & yyChBufferStart [yyBytesRead]) { \
+	yyStart (LCOM); \
+	EMIT_CHUNK (tok_comment_const, from, yyChBufferIndex - from, 0); \
+     } else { \
+	yyStart (STD_STATE); \
+	EMIT_CHUNK (tok_comment_const, from, yyChBufferIndex - from, 1); \
+	COMMENT_END (yyChBufferIndex); \
+     } \
+  }
+
+  /* Copy the body of a string in bulk, starting at `From', up to the next
+   * quote, backslash, newline, blank or tab, or up to the end of the current
+   * buffer. Blanks and tabs are skipped by the builtin actions, they are not
+   * part of the value.
+   */
+  # define SCAN_STRING(From) { \
+     yytusChar * stop = ScanStringBody ((yytusChar *) (From), \
+	& yyChBufferStart [yyBytesRead]); \
+     int n = (int) (stop - (yytusChar *) (From)); \
+     if (chunk_handler [tok_string_const] != NULL) { \
+	EMIT_CHUNK (tok_string_const, (From), n, 0); \
+     } else if (len + n >= MAX_STRING_LEN) { \
+	Message ("String zu lang", xxError, l_scan_Attribute.Position); \
+	len = 0; \
+	string_escaped = 1; \
+     } else { \
+	memcpy (& string [len], (From), n); \
+	len += n; \
+     } \
+     if (stop < & yyChBufferStart [yyBytesRead] && (* stop == ' ' || * stop == '\t')) \
+	string_escaped = 1; \
+     yyChBufferIndex = stop; \
+  }
+
+  /* Append a decoded escape sequence to the string */
+  # define STRING_CHAR(Ch) { \
+     char ch = Ch; \
+     string_escaped = 1; \
+     if (chunk_handler [tok_string_const] != NULL) { \
+	EMIT_CHUNK (tok_string_const, & ch, 1, 0); \
+     } else if (len < MAX_STRING_LEN) { \
+	string [len++] = ch; \
+     } \
+  }
+
+  /* The state of the rules, kept across calls of GetToken, so that it can be
+   * checkpointed.
+   */
+  # define MAX_STRING_LEN 2048
+  static char string [MAX_STRING_LEN+1];
+  static int len;
+  static l_scan_tOffset string_offset;	/* of the body of the current string */
+  static int string_escaped;		/* escapes, blanks or overflow:
+					 * value != text */
+  static int nestingCount;		/* comments in comments */
+
+  /* The inputs begun and not closed yet. Every l_scan_Begin... of the frame
+   * calls yyInitialize, which stacks the state of the frame (see yyFileStack),
+   * and l_scan_CloseFile calls l_scan_CloseSource. BeginInput and EndInput
+   * stack the state of the rules and of this section along with it.
+   */
+  typedef struct {
+    yyStateRange	Start, Previous;
+    int			NestingCount;
+    int			IncludeDepth;
+    char *		Directory;
+    char *		Window;
+    size_t		WindowLength;
+    int			Source;
+    l_scan_tOffset	SourceOffset, NextOffset;
+  } tInput;
+
+  static tInput *	inputs	      = NULL;
+  static unsigned long	inputs_size   = 0;
+  static int		input_count   = 0;
+  static int		include_depth = 0;	/* of the current input */
+  static char *		directory     = NULL;	/* of its file, NULL: "." */
+  static rbool		including     = rfalse;	/* an include file is begun */
+
+  static void EndOfInput (void);
+
+  static void BeginInput (void)
+  {
+    tInput * input;
+    if ((unsigned long) input_count == inputs_size) {
+      if (inputs_size == 0) {
+	inputs_size = 16;
+	MakeArray ((char * *) & inputs, & inputs_size, (unsigned long) sizeof (tInput));
+      } else {
+	ExtendArray ((char * *) & inputs, & inputs_size, (unsigned long) sizeof (tInput));
+      }
+      if (inputs == NULL) yyErrorMessage (xxScannerOutOfMemory);
+    }
+    input = & inputs [input_count ++];
+    input->Start	= yyStartState;
+    input->Previous	= yyPreviousStart;
+    input->NestingCount	= nestingCount;
+    input->IncludeDepth	= include_depth;
+    input->Directory	= directory;
+    input->Window	= window;
+    input->WindowLength	= window_length;
+    input->Source	= source;
+    input->SourceOffset	= source_offset;
+    input->NextOffset	= next_offset;
+    directory	  = NULL;
+    window	  = NULL;
+    source_offset = next_offset = 0;
+    if ((unsigned long) source_count == source_names_size) {
+      if (source_names_size == 0) {
+	source_names_size = 16;
+	MakeArray ((char * *) & source_names, & source_names_size, (unsigned long) sizeof (char *));
+      } else {
+	ExtendArray ((char * *) & source_names, & source_names_size, (unsigned long) sizeof (char *));
+      }
+      if (source_names == NULL) yyErrorMessage (xxScannerOutOfMemory);
+    }
+    source = source_count ++;
+    source_names [source] = NULL;
+    if (including) {		/* continues the including input */
+      include_depth ++;
+    } else {
+      include_depth   = 0;
+      illegal_runs    = 0;
+      illegal_pending = 0;
+      SetStdState ();
+    }
+  }
+
+  static void EndInput (void)
+  {
+    tInput * input;
+    if (input_count == 0) return;
+    input = & inputs [-- input_count];
+    if (include_depth > input->IncludeDepth) {	/* end of an include file */
+      EndOfInput ();
+      yyStartState    = input->Start;
+      yyPreviousStart = input->Previous;
+      nestingCount    = input->NestingCount;
+      SetStdState ();
+    }
+    free (directory);
+    directory	  = input->Directory;
+    window	  = input->Window;
+    window_length = input->WindowLength;
+    include_depth = input->IncludeDepth;
+    source	  = input->Source;
+    source_offset = input->SourceOffset;
+    next_offset	  = input->NextOffset;
+  }
+
+  /* The frame defines its buffer pointers after this section, so the code
+   * of this section reaches them via their addresses, which are taken by
+   * every call of yyInitialize.
+   */
+  static yytusChar * *	buffer_index = NULL;	/* & yyChBufferIndex */
+  static yytusChar * *	buffer_start = NULL;	/* & yyChBufferStart */
+
+  # define yyInitialize()	(BeginInput (), buffer_index = & yyChBufferIndex, \
+				 buffer_start = & yyChBufferStart, yyInitialize ())
+  # define l_scan_CloseSource(File) (EndInput (), l_scan_CloseSource (File))
+
+  /* Returns the directory of `FileName' with a trailing "/", NULL for "." */
+  static char * DirectoryOf (char * FileName)
+  {
+    char * slash = strrchr (FileName, '/');
+    char * dir;
+    if (slash == NULL) return NULL;
+    dir = malloc (slash - FileName + 2);
+    if (dir == NULL) yyErrorMessage (xxScannerOutOfMemory);
+    memcpy (dir, FileName, slash - FileName + 1);
+    dir [slash - FileName + 1] = '\0';
+    return dir;
+  }
+
+  /* The current input is the file `FileName' */
+  static void NameInput (char * FileName)
+  {
+    char * name = malloc (strlen (FileName) + 1);
+    if (name == NULL) yyErrorMessage (xxScannerOutOfMemory);
+    strcpy (name, FileName);
+    source_names [source] = name;
+    directory = DirectoryOf (FileName);
+  }
+
+  /* The current input is the block of `Length' bytes at `Text'. The Source
+   * module only stacks it, ReadSource reads it.
+   */
+  static void BeginWindow (char * Text, size_t Length)
+  {
+    l_scan_BeginSourceGeneric (Text);
+    window	  = Text;
+    window_length = Length;
+  }
+
+  /* A file which can be mapped into memory is scanned there, so the values
+   * point into it (see VIEW), other files are read.
+   */
+  static int BeginSourceFile (char * FileName)
+  {
+    char * text;
+    size_t length;
+    NameInput (FileName);
+    if (! MapInclude (FileName, & text, & length))
+      return l_scan_BeginSourceFile (FileName);
+    BeginWindow (text, length);
+    return StdIn;			/* not used for memory input */
+  }
+
+  # define l_scan_BeginSourceFile BeginSourceFile
+
+  # define l_scan_BeginSourceMemory(Ptr) \
+     BeginWindow ((char *) (Ptr), strlen ((char *) (Ptr)))
+  # define l_scan_BeginSourceMemoryN(Ptr, Length) \
+     BeginWindow ((char *) (Ptr), (size_t) (Length))
+
+  /* Returns the malloc'ed path of the file `Name' included by the current input */
+  static char * IncludePath (char * Name)
+  {
+    char * path = malloc ((directory == NULL ? 0 : strlen (directory)) + strlen (Name) + 1);
+    if (path == NULL) yyErrorMessage (xxScannerOutOfMemory);
+    if (directory == NULL || Name [0] == '/') {
+      strcpy (path, Name);
+    } else {
+      strcpy (path, directory);
+      strcat (path, Name);
+    }
+    return path;
+  }
+
+  /* Begin to scan the include file `Name' in place of the current token */
+  static void BeginInclude (char * Name)
+  {
+    char * path = IncludePath (Name);
+    char * text;
+    size_t length;
+    if (include_depth >= MAX_INCLUDE_DEPTH) {
+      Message ("Include files nested too deeply", xxError, l_scan_Attribute.Position);
+    } else if (! MapInclude (path, & text, & length)) {
+      MessageI ("Cannot open include file", xxError, l_scan_Attribute.Position, xxString, Name);
+    } else {
+      if (length + 256 < max_buffer_size)
+	buffer_size = length + 256;
+      including = rtrue;
+      l_scan_BeginMemoryL (text, length);
+      including = rfalse;
+      buffer_size = max_buffer_size;
+      NameInput (path);
+    }
+    free (path);
+  }
+
+  void l_scan_BeginMemoryL (char * Text, size_t Length)
+  {
+    l_scan_BeginGeneric (Text);		/* see BeginWindow */
+    window	  = Text;
+    window_length = Length;
+  }
+
+  /* Scan a file mapped into memory, so the views point into the file */
+  int l_scan_BeginMappedFile (char * FileName)
+  {
+    char * text;
+    size_t length;
+    if (! MapInclude (FileName, & text, & length)) return 0;
+    l_scan_BeginMemoryL (text, length);
+    NameInput (FileName);
+    return 1;
+  }
+
+  # define CHECKPOINT_MAGIC	0x6c736331	/* "lsc1" */
+  # define MAX_CHECKPOINT_STST	8
+
+  typedef struct {
+    int32_t	Magic;
+    int16_t	Start, Previous;
+    int32_t	NestingCount;
+    int32_t	Length;
+    uint32_t	Line;
+    int32_t	Column;			/* of the next character */
+    int64_t	Offset;			/* of the next character */
+    int16_t	StStDepth;
+    int16_t	StSt [MAX_CHECKPOINT_STST];
+  } tCheckpoint;
+
+  typedef char tCheckpointFits [sizeof (tCheckpoint) <= sizeof (l_scan_tCheckpoint) ? 1 : -1];
+
+  int l_scan_Checkpoint (l_scan_tCheckpoint * Blob)
+  {
+    tCheckpoint * c = (tCheckpoint *) Blob;
+    if (include_depth > 0 || buffer_index == NULL) return 0;
+    memset (Blob, 0, sizeof (l_scan_tCheckpoint));
+    c->Magic		= CHECKPOINT_MAGIC;
+    c->Start		= (int16_t) yyStartState;
+    c->Previous		= (int16_t) yyPreviousStart;
+    c->NestingCount	= nestingCount;
+    c->Length		= len;
+    c->Line		= yyLineCount;
+    c->Column		= (int32_t) (* buffer_index - yyLineStart);
+    c->Offset		= OFFSET (* buffer_index);
+  # if defined xxyyPush | defined xxyyPop
+    if (yyStStStackIdx > MAX_CHECKPOINT_STST) return 0;
+    c->StStDepth = (int16_t) yyStStStackIdx;
+    { unsigned int i;
+      for (i = 0; i < yyStStStackIdx; i ++) c->StSt [i] = (int16_t) yyStStStackPtr [i];
+    }
+  # endif
+    return 1;
+  }
+
+  l_scan_tOffset l_scan_CheckpointOffset (l_scan_tCheckpoint * Blob)
+  {
+    return ((tCheckpoint *) Blob)->Offset;
+  }
+
+  unsigned int l_scan_CheckpointLine (l_scan_tCheckpoint * Blob)
+  {
+    return ((tCheckpoint *) Blob)->Line;
+  }
+
+  /* Continue in the state of the checkpoint, the input has just begun */
+  static void ApplyCheckpoint (tCheckpoint * c)
+  {
+    if (c->Magic != CHECKPOINT_MAGIC)
+      Message ("Invalid scanner checkpoint", xxFatal, l_scan_Attribute.Position);
+    yyStartState	= c->Start;
+    yyPreviousStart	= c->Previous;
+    nestingCount	= c->NestingCount;
+    len			= c->Length;
+    yyLineCount		= c->Line;
+    yyLineStart		= * buffer_start - c->Column;
+    trivia_count	= 0;
+    SetStdState ();
+  # if defined xxyyPush | defined xxyyPop
+    yyStStStackIdx = 0;
+    { int i;
+      for (i = 0; i < c->StStDepth; i ++) yyPush (c->StSt [i]);
+      yyStartState = c->Start;
+    }
+  # endif
+  }
+
+  /* Continue the input just begun at `Offset', as if the bytes in front of
+   * it had been read. Returns 0 if the input cannot be positioned.
+   */
+  static int SeekInput (l_scan_tOffset Offset)
+  {
+    if (window != NULL) {
+      if (Offset < 0 || (uint64_t) Offset > window_length) return 0;
+    } else if (lseek (yySourceFile, (off_t) Offset, SEEK_SET) != (off_t) Offset) {
+      return 0;
+    }
+    source_offset = next_offset = Offset;
+    return 1;
+  }
+
+  void l_scan_RestoreMemory (l_scan_tCheckpoint * Blob, char * Text, size_t Length)
+  {
+    tCheckpoint * c = (tCheckpoint *) Blob;
+    l_scan_BeginMemoryL (Text, Length);
+    (void) SeekInput (c->Offset);
+    ApplyCheckpoint (c);
+  }
+
+  int l_scan_RestoreFile (l_scan_tCheckpoint * Blob, char * FileName)
+  {
+    tCheckpoint * c = (tCheckpoint *) Blob;
+    l_scan_BeginFile (FileName);
+    if (! SeekInput (c->Offset)) return 0;
+    ApplyCheckpoint (c);
+    return 1;
+  }
+
+  /* Check that strings and comments are closed, at the end of every input */
+  static void EndOfInput (void)
+  {
+    switch (yyStartState) {
+    case STD:
+    case TRIV:
+      /* ok */
+      break;
+    case LCOM:				/* l_scan_TokenOffset is the end */
+      EMIT_CHUNK (tok_comment_const, l_scan_TokenPtr, 0, 1);
+      COMMENT_END_AT (l_scan_TokenOffset);
+      break;
+    case STR: 
+	Message ("Panic! You opend a String but never closed it!", xxFatal, l_scan_Attribute.Position);
+	break;
+    case COM: 
+	Message ("Panic! You opend a Comment but never closed it!", xxFatal, l_scan_Attribute.Position);
+	break;
+    default:
+      Message ("Panic! OOPS: that should not happen!!", xxFatal, l_scan_Attribute.Position);
+      break;
+    }
+  }
+
+  /* The start of every call of GetToken: the frame has no hook for it, so
+   * the generated GetToken is renamed and called from here.
+   */
+  static int GetToken (void);
+
+  int l_scan_GetToken (void)
+  {
+    trivia_count = 0;	/* the trivia belong to the token returned next */
+    return GetToken ();
+  }
 
-/* line 360 "l_scan.c" */
+  # define l_scan_GetToken GetToken
+
+/* line 1292 "l_scan.c" */
 
 # ifndef yySetPosition
 # define yySetPosition l_scan_Attribute.Position.Line = yyLineCount; \
@@ -516,30 +1448,63 @@ static	yytFileStack *	yyFileStackPtr	;
 int l_scan_GetToken ARGS ((void))
 {
    register	yyStateRange	yyState;
+# ifdef yyLastAccept
+		yyStateRange	yyLastState;	/* last final state passed */
+		yytusChar *	yyLastIndex;	/* and the character behind it */
+# else
    register	yyStateRange *	yyStatePtr;
+# endif
    register	yytusChar *	yyChBufferIndexReg;
    register	yyCombType * *	yyBasePtrReg = yyBasePtr;
-/* line 61 "l.rex" */
+/* line 991 "l.rex" */
 
- /* user-defined local variables of the generated GetToken routine */
- # define MAX_STRING_LEN 2048
-  char string [MAX_STRING_LEN+1]; 
-  int len;
-  int nestingCount; /* comments in comments */
+ /* user-defined local variables of the generated GetToken routine:
+  * none, the state of the rules is kept in GLOBAL (see l_scan_Checkpoint)
+  */
 
-/* line 531 "l_scan.c" */
+/* line 1466 "l_scan.c" */
 
 yyBegin:
    yyState		= yyStartState;		/* initialize */
+# ifndef yyLastAccept
    yyStatePtr		= & yyStateStack [1];
+# endif
    yyChBufferIndexReg	= yyChBufferIndex;
    l_scan_TokenPtr		= (yytChar *) yyChBufferIndexReg;
+# ifdef yyLastAccept
+   yyLastState		= yyDefaultState;
+   yyLastIndex		= yyChBufferIndexReg;
+# endif
 
    /* ASSERT yyChBuffer [yyChBufferIndex] == first character */
 
 yyContinue:		/* continue after sentinel or skipping blanks */
    for (;;) {		/* execute as many state transitions as possible */
 			/* determine next state and get next character */
+# ifdef yyLastAccept
+      /* Only the last final state and its position are remembered. The
+       * default states are followed in yyCheckState, yyState stays the
+       * current state for the end of buffer sentinel.
+       */
+      register yyStateRange  yyCheckState = yyState;
+      register yyCombType * yyTablePtr;
+      while ((yyTablePtr = yyBasePtrReg [yyCheckState] +
+		 yyToClass (* yyChBufferIndexReg))->yyCheck != yyCheckState)
+	 if ((yyCheckState = yyDefault [yyCheckState]) == yyDNoState)
+	    goto yyLastFinal;
+      if (yyFinal [yyTablePtr->yyNext]) {
+	 if (yyTablePtr->yyNext == yyEobState) {
+	    l_scan_TokenLength =
+		  (int) (yyChBufferIndexReg - (yytusChar *) l_scan_TokenPtr);
+	    yyChBufferIndex = yyChBufferIndexReg;
+	    goto yyEndOfBuffer;
+	 }
+	 yyLastState = yyTablePtr->yyNext;	/* remember final state */
+	 yyLastIndex = yyChBufferIndexReg + 1;
+      }
+      yyState = yyTablePtr->yyNext;		/* determine next state */
+      yyChBufferIndexReg ++;			/* get next character */
+# else
       register yyCombType * yyTablePtr =
 		      yyBasePtrReg [yyState] + yyToClass (* yyChBufferIndexReg);
       if (yyTablePtr->yyCheck == yyState) {
@@ -549,219 +1514,319 @@ yyContinue:		/* continue after sentinel or skipping blanks */
 	 goto yyContinue;
       }
       if ((yyState = yyDefault [yyState]) == yyDNoState) break;
+# endif
    }
 
+# ifdef yyLastAccept
+yyLastFinal:
+# endif
    for (;;) {				/* search for last final state */
+# ifdef yyLastAccept
+      yyChBufferIndexReg = yyLastIndex;		/* return characters */
+# endif
       l_scan_TokenLength =
 	    (int) (yyChBufferIndexReg - (yytusChar *) l_scan_TokenPtr);
       yyChBufferIndex = yyChBufferIndexReg;
+# ifdef yyLastAccept
+switch (yyLastState) {
+# else
 switch (* -- yyStatePtr) {
-case 14:;
+# endif
+case 34:;
 yySetPosition
-/* line 110 "l.rex" */
-{ return tok_begin_const;
-/* line 564 "l_scan.c" */
+/* line 1051 "l.rex" */
+{ /* rule begin */ return tok_begin_const;
+/* line 1540 "l_scan.c" */
 } goto yyBegin;
-case 8:;
+case 14:;
 yySetPosition
-/* line 114 "l.rex" */
-{
-	 l_scan_Attribute.int_const.Value = malloc (l_scan_TokenLength+1);
-	 l_scan_GetWord (l_scan_Attribute.int_const.Value);
+/* line 1055 "l.rex" */
+{ /* rule int */
+	 VIEW (l_scan_Attribute.int_const.Value);
 	 return tok_int_const;
 	
-/* line 574 "l_scan.c" */
+/* line 1549 "l_scan.c" */
 } goto yyBegin;
-case 13:;
-case 17:;
+case 24:;
+case 29:;
 yySetPosition
-/* line 121 "l.rex" */
-{
-	 l_scan_Attribute.float_const.Value = malloc (l_scan_TokenLength+1);
-	 l_scan_GetWord (l_scan_Attribute.float_const.Value);
+/* line 1061 "l.rex" */
+{ /* rule float */
+	 VIEW (l_scan_Attribute.float_const.Value);
 	 return tok_float_const;
 	
-/* line 585 "l_scan.c" */
+/* line 1559 "l_scan.c" */
 } goto yyBegin;
-case 10:;
+case 41:;
 yySetPosition
-/* line 128 "l.rex" */
-{
-	    return tok_comment_const;
+/* line 1071 "l.rex" */
+{ /* rule include */
+	  char * name = malloc (l_scan_TokenLength + 1);
+	  char * file;
+	  l_scan_GetWord (name);
+	  file = strchr (name, '"') + 1;
+	  * strchr (file, '"') = '\0';
+	  BeginInclude (file);
+	  free (name);
+	
+/* line 1573 "l_scan.c" */
+} goto yyBegin;
+case 11:;
+yySetPosition
+/* line 1083 "l.rex" */
+{ /* rule line_comment */
+	    COMMENT_START (l_scan_TokenPtr);
+	    SKIP_LINE (yyChBufferIndex);
+	    if (trivia_mode == l_scan_TriviaToken) return tok_comment_const;
 	  
-/* line 593 "l_scan.c" */
+/* line 1583 "l_scan.c" */
 } goto yyBegin;
-case 43:;
+case 47:;
 yySetPosition
-/* line 133 "l.rex" */
-{
+/* line 1091 "l.rex" */
+{ /* rule line_comment_end */
+	  yyEol (0);
+	  yyStart (STD_STATE);
+	  EMIT_CHUNK (tok_comment_const, l_scan_TokenPtr, 0, 1);
+	  COMMENT_END (l_scan_TokenPtr);
+	
+/* line 1594 "l_scan.c" */
+} goto yyBegin;
+case 21:;
+yySetPosition
+/* line 1098 "l.rex" */
+{ /* rule line_comment_body */ SKIP_LINE (l_scan_TokenPtr); 
+/* line 1600 "l_scan.c" */
+} goto yyBegin;
+case 22:;
+yySetPosition
+/* line 1104 "l.rex" */
+{ /* rule white_space */
+	  yytusChar * p;
+	  for (p = (yytusChar *) l_scan_TokenPtr; p < yyChBufferIndex; p ++) {
+	    if (* p == '\n') {
+	      yyLineCount ++;
+	      yyLineStart = p;
+	    } else if (* p == '\t') {
+	      yyLineStart -= (yyTabSpace - 1 - (p - yyLineStart - 1)) & (yyTabSpace - 1);
+	    }
+	  }
+	  TRIVIA (l_scan_TokenPtr, l_scan_TokenLength);
+	
+/* line 1617 "l_scan.c" */
+} goto yyBegin;
+case 56:;
+yySetPosition
+/* line 1118 "l.rex" */
+{ /* rule comment */
+	   COMMENT_START (l_scan_TokenPtr);
 	   yyStart (COM);
+	   nestingCount = 1;
+	   SKIP_COMMENT (yyChBufferIndex);
+	
+/* line 1628 "l_scan.c" */
+} goto yyBegin;
+case 57:;
+yySetPosition
+/* line 1126 "l.rex" */
+{ /* rule comment_nested */
 	   nestingCount++;
+	   SKIP_COMMENT (l_scan_TokenPtr);
 	
-/* line 602 "l_scan.c" */
+/* line 1637 "l_scan.c" */
 } goto yyBegin;
-case 41:;
+case 54:;
 yySetPosition
-/* line 139 "l.rex" */
-{
+/* line 1132 "l.rex" */
+{ /* rule comment_end */
 	    nestingCount--;
-	    if(nestingCount == 0) yyStart(STD);
+	    if (nestingCount > 0) {
+	       SKIP_COMMENT (l_scan_TokenPtr);
+	    } else {
+	       yyStart (STD_STATE);
+	       EMIT_CHUNK (tok_comment_const, yyChBufferIndex, 0, 1);
+	       COMMENT_END (yyChBufferIndex);
+	    }
 	
-/* line 611 "l_scan.c" */
+/* line 1652 "l_scan.c" */
 } goto yyBegin;
-case 39:;
+case 18:;
+case 19:;
+case 20:;
 yySetPosition
-/* line 144 "l.rex" */
-{
-/* line 617 "l_scan.c" */
+/* line 1144 "l.rex" */
+{ /* rule comment_body */ SKIP_COMMENT (l_scan_TokenPtr); 
+/* line 1660 "l_scan.c" */
 } goto yyBegin;
-case 32:;
+case 52:;
 yySetPosition
-/* line 148 "l.rex" */
-{
+/* line 1148 "l.rex" */
+{ /* rule string */
 	   yyStart (STR);
 	   len = 0;
+	   string_offset = OFFSET (yyChBufferIndex);
+	   string_escaped = 0;
+	   SCAN_STRING (yyChBufferIndex);
 	 
-/* line 626 "l_scan.c" */
+/* line 1672 "l_scan.c" */
 } goto yyBegin;
-case 31:;
+case 53:;
 yySetPosition
-/* line 153 "l.rex" */
-{ 
-	    yyStart(STD);
-	    string[len] = '\0';
-	    l_scan_Attribute.string_const.Value = malloc (len+1);
-	    strcpy (l_scan_Attribute.string_const.Value, string);
+/* line 1156 "l.rex" */
+{ /* rule string_end */
+	    yyStart (STD_STATE);
+	    if (chunk_handler [tok_string_const] != NULL) {
+	      EMIT_CHUNK (tok_string_const, l_scan_TokenPtr, 0, 1);
+	      l_scan_Attribute.string_const.Value.Ptr = NULL;
+	      l_scan_Attribute.string_const.Value.Length = 0;
+	      return tok_string_const;
+	    }
+	    l_scan_Attribute.string_const.Value.Length = len;
+	    if (window != NULL && ! string_escaped) {
+	      l_scan_Attribute.string_const.Value.Ptr = window + string_offset;
+	    } else {
+	      l_scan_Attribute.string_const.Value.Ptr = PoolCopy (string, len);
+	    }
 	    return tok_string_const;
 	    
-/* line 638 "l_scan.c" */
+/* line 1693 "l_scan.c" */
 } goto yyBegin;
-case 7:;
+case 50:;
 yySetPosition
-/* line 162 "l.rex" */
-{ /* we're inside the string */
-          if (len + l_scan_TokenLength+1 >= MAX_STRING_LEN) {
-	    Message ("String zu lang", xxError, l_scan_Attribute.Position);
-	    len = 0;
-	  } else {
-  	    len += l_scan_GetWord (&string[len]);
-	  }
-        
-/* line 650 "l_scan.c" */
+/* line 1173 "l.rex" */
+{ /* rule string_backslash */ STRING_CHAR ('\\');
+/* line 1699 "l_scan.c" */
 } goto yyBegin;
-case 29:;
+case 51:;
 yySetPosition
-/* line 171 "l.rex" */
-{string[len++] = '\\';
-/* line 656 "l_scan.c" */
+/* line 1175 "l.rex" */
+{ /* rule string_quote */ STRING_CHAR ('"');
+/* line 1705 "l_scan.c" */
 } goto yyBegin;
-case 30:;
+case 46:;
 yySetPosition
-/* line 173 "l.rex" */
-{string[len++] = '"';
-/* line 662 "l_scan.c" */
+/* line 1177 "l.rex" */
+{ /* rule string_newline */ Message ("Panic! no linebreaks within a string...", xxFatal, l_scan_Attribute.Position); 
+/* line 1711 "l_scan.c" */
 } goto yyBegin;
-case 28:;
+case 17:;
 yySetPosition
-/* line 175 "l.rex" */
-{ Message ("Panic! no linebreaks within a string...", xxFatal, l_scan_Attribute.Position); 
-/* line 668 "l_scan.c" */
+/* line 1180 "l.rex" */
+{ /* rule string_body */
+	  /* we're inside the string, copy up to the next special character */
+	  SCAN_STRING (l_scan_TokenPtr);
+        
+/* line 1720 "l_scan.c" */
 } goto yyBegin;
-case 9:;
 case 15:;
-case 18:;
-case 19:;
-case 20:;
+case 16:;
+case 26:;
+case 30:;
+case 32:;
 yySetPosition
-/* line 179 "l.rex" */
-{
-	  l_scan_Attribute.identifier_const.Value = malloc (l_scan_TokenLength+1);
-	  l_scan_GetWord (l_scan_Attribute.identifier_const.Value);
+/* line 1187 "l.rex" */
+{ /* rule identifier */
+	  VIEW (l_scan_Attribute.identifier_const.Value);
 	  return tok_identifier_const;
 	 
-/* line 682 "l_scan.c" */
+/* line 1733 "l_scan.c" */
 } goto yyBegin;
-case 11:;
+case 12:;
 yySetPosition
-/* line 186 "l.rex" */
-{
-	  l_scan_Attribute.operator_const.Value = malloc (l_scan_TokenLength+1);
-	  l_scan_GetWord (l_scan_Attribute.operator_const.Value);
+/* line 1193 "l.rex" */
+{ /* rule operator */
+	  VIEW (l_scan_Attribute.operator_const.Value);
 	  return tok_operator_const;
 	
-/* line 692 "l_scan.c" */
+/* line 1742 "l_scan.c" */
 } goto yyBegin;
-case 27:;
+case 49:;
 {/* BlankAction */
 while (* yyChBufferIndexReg ++ == ' ') ;
 l_scan_TokenPtr = (yytChar *) -- yyChBufferIndexReg;
 yyState = yyStartState;
-yyStatePtr = & yyStateStack [1];
+yyLastState = yyDefaultState;
+yyLastIndex = yyChBufferIndexReg;
 goto yyContinue;
-/* line 701 "l_scan.c" */
+/* line 1752 "l_scan.c" */
 } goto yyBegin;
-case 26:;
+case 48:;
 {/* TabAction */
 yyTab;
-/* line 706 "l_scan.c" */
+/* line 1757 "l_scan.c" */
 } goto yyBegin;
-case 25:;
+case 45:;
 {/* EolAction */
 yyEol (0);
-/* line 711 "l_scan.c" */
+/* line 1762 "l_scan.c" */
 } goto yyBegin;
-case 1:;
-case 2:;
-case 3:;
-case 4:;
-case 5:;
-case 6:;
-case 12:;
-case 16:;
-case 21:;
-case 22:;
-case 33:;
-case 34:;
-case 35:;
-case 36:;
-case 37:;
-case 38:;
-case 40:;
-case 42:;
 	 /* non final states */
 	 yyChBufferIndexReg --;			/* return character */
 	 break;
 
-case 24:
+case 44:
 	 yySetPosition
       l_scan_TokenLength   = 1;
 	 yyChBufferIndex = ++ yyChBufferIndexReg;
 	 {
-/* line 69 "l.rex" */
-
-  /* What happens if no scanner rule matches the input */
-  MessageI ("Panic! Illegal character", xxError, l_scan_Attribute.Position, xxCharacter, (char*)*l_scan_TokenPtr);
+/* line 997 "l.rex" */
+
+  /* What happens if no scanner rule matches the input:
+   * the whole run of illegal characters is reported at once
+   */
+  yytusChar * end = & yyChBufferStart [yyBytesRead];
+  yyChBufferIndex = SkipIllegal (yyChBufferIndex, end);
+  l_scan_TokenLength = (int) (yyChBufferIndex - (yytusChar *) l_scan_TokenPtr);
+  if (illegal_pending > 0) {		/* continues the run, see FLUSH_ILLEGAL */
+    l_scan_Attribute.Position = illegal_position;
+    l_scan_TokenLength += illegal_pending;
+    illegal_pending = 0;
+  } else {
+    illegal_first = * l_scan_TokenPtr;
+  }
+  if (! yyEof && yyChBufferIndex + 1 >= end) {	/* may continue behind */
+    illegal_pending  = l_scan_TokenLength;
+    illegal_position = l_scan_Attribute.Position;
+    illegal_end	     = OFFSET (yyChBufferIndex);
+  } else {
+    ReportIllegal (l_scan_Attribute.Position, l_scan_TokenLength, illegal_first);
+    if (return_illegal) {
+      l_scan_Attribute.illegal_const.Count = l_scan_TokenLength;
+      return tok_illegal_const;
+    }
+  }
 
-/* line 745 "l_scan.c" */
+/* line 1800 "l_scan.c" */
 	 }
 	 goto yyBegin;
 
       case yyDNoState:
 	 goto yyBegin;
 
-case 23:
+case 43:
+# ifdef yyLastAccept
+      yyEndOfBuffer:	/* yyState: the state in front of the sentinel */
+# else
 	 yyChBufferIndex = -- yyChBufferIndexReg; /* undo last state transit */
 	 if (-- l_scan_TokenLength == 0) {		/* get previous state */
 	    yyState = yyStartState;
 	 } else {
 	    yyState = * (yyStatePtr - 1);
 	 }
+# endif
 
 	 if (yyChBufferIndex != & yyChBufferStart [yyBytesRead]) {
 					/* end of buffer sentinel in buffer */
 	    if ((yyState = yyEobTrans [yyState]) == yyDNoState) continue;
 	    yyChBufferIndexReg ++;
+# ifdef yyLastAccept
+	    if (yyFinal [yyState]) {
+	       yyLastState = yyState;
+	       yyLastIndex = yyChBufferIndexReg;
+	    }
+# else
 	    * yyStatePtr ++ = yyState;		/* push state */
+# endif
 	    goto yyContinue;
 	 }
 						/* end of buffer reached */
@@ -769,6 +1834,15 @@ case 23:
 	    register yytChar * yySource;
 	    register yytChar * yyTarget;
 	    unsigned long yyChBufferFree;
+# ifdef yyLastAccept
+	    ptrdiff_t yyLastLength =
+		  yyLastIndex - (yytusChar *) l_scan_TokenPtr;
+
+	    if (yyChBufferSize == 0) {
+	       yyInitialize ();
+	       yyChBufferIndexReg = yyChBufferIndex;
+	    }
+# else
 
 	    if (yyChBufferSize == 0) {
 	       yyStateRange * yyOldStateStack = yyStateStack;
@@ -776,6 +1850,7 @@ case 23:
 	       yyStatePtr += yyStateStack - yyOldStateStack;
 	       yyChBufferIndexReg = yyChBufferIndex;
 	    }
+# endif
 	    yySource = l_scan_TokenPtr - 1;
 	    yyTarget = (yytChar *) & yyChBufferPtr
 		[(yyMaxAlign - 1 - l_scan_TokenLength) & (yyMaxAlign - 1)];
@@ -807,6 +1882,7 @@ case 23:
 	       yyChBufferStart2	 = (yytChar *) yyChBufferStart;
 	       yyChBufferFree = Exp2 (Log2 (yyChBufferSize - 4 -
 			yyMaxAlign - l_scan_TokenLength));
+# ifndef yyLastAccept
 	       if (yyStateStackSize < yyChBufferSize) {
 		  yyStateRange * yyOldStateStack = yyStateStack;
 		  ExtendArray ((char * *) & yyStateStack, & yyStateStackSize,
@@ -815,6 +1891,7 @@ case 23:
 		     yyErrorMessage (xxScannerOutOfMemory);
 		  yyStatePtr	+= yyStateStack - yyOldStateStack;
 	       }
+# endif
 	    }
 						/* read buffer and restart */
 	    yyChBufferIndex = yyChBufferIndexReg = yyChBufferStart;
@@ -824,36 +1901,28 @@ case 23:
 	    if (yyBytesRead <= 0) { yyBytesRead = 0; yyEof = rtrue; }
 	    yyChBufferStart [yyBytesRead    ] = yyEobCh;
 	    yyChBufferStart [yyBytesRead + 1] = '\0';
+# ifdef yyLastAccept
+	    yyLastIndex = (yytusChar *) l_scan_TokenPtr + yyLastLength;
+# endif
 	    goto yyContinue;
 	 }
 
 	 if (l_scan_TokenLength == 0) {		/* end of file reached */
 	    if (yyChBufferSize == 0) return l_scan_EofToken;
+# ifdef yyLastAccept
+	    yyLastState = yyEobState;
+# endif
 	    yySetPosition
 	    l_scan_CloseFile ();
 # if yyInitFileStackSize != 0
 	    if (yyFileStackPtr == yyFileStack) {
-/* line 74 "l.rex" */
+/* line 1024 "l.rex" */
 
   /* What should be done if the end-of-input-file has been reached? */
-
-  /* E.g.: check hat strings and comments are closed. */
-  switch (yyStartState) {
-  case STD:
-    /* ok */
-    break;
-  case STR: 
-      Message ("Panic! You opend a String but never closed it!", xxFatal, l_scan_Attribute.Position);
-  case COM: 
-      Message ("Panic! You opend a Comment but never closed it!", xxFatal, l_scan_Attribute.Position);
-  default:
-    Message ("Panic! OOPS: that should not happen!!", xxFatal, l_scan_Attribute.Position);
-    break;
-  }
-
+  EndOfInput ();
   /* implicit: return the EofToken */
 
-/* line 856 "l_scan.c" */
+/* line 1926 "l_scan.c" */
 	    }
 	    if (yyFileStackPtr == yyFileStack) {
 	       l_scan_ResetScanner ();
@@ -861,27 +1930,13 @@ case 23:
 	    }
 	    goto yyBegin;
 # else
-/* line 74 "l.rex" */
+/* line 1024 "l.rex" */
 
   /* What should be done if the end-of-input-file has been reached? */
-
-  /* E.g.: check hat strings and comments are closed. */
-  switch (yyStartState) {
-  case STD:
-    /* ok */
-    break;
-  case STR: 
-      Message ("Panic! You opend a String but never closed it!", xxFatal, l_scan_Attribute.Position);
-  case COM: 
-      Message ("Panic! You opend a Comment but never closed it!", xxFatal, l_scan_Attribute.Position);
-  default:
-    Message ("Panic! OOPS: that should not happen!!", xxFatal, l_scan_Attribute.Position);
-    break;
-  }
-
+  EndOfInput ();
   /* implicit: return the EofToken */
 
-/* line 884 "l_scan.c" */
+/* line 1940 "l_scan.c" */
 	    l_scan_ResetScanner ();
 	    return l_scan_EofToken;
 # endif
@@ -896,6 +1951,7 @@ case 23:
 
 static void yyInitialize ARGS ((void))
    {
+# ifndef yyLastAccept
       if (yyStateStackSize == 0) {
 	 yyStateStackSize = yyInitBufferSize;
 	 MakeArray ((char * *) & yyStateStack, & yyStateStackSize,
@@ -903,6 +1959,7 @@ static void yyInitialize ARGS ((void))
 	 if (yyStateStack == NULL) yyErrorMessage (xxScannerOutOfMemory);
 	 yyStateStack [0] = yyDefaultState;
       }
+# endif
 # if yyInitFileStackSize != 0
       if (yyFileStackSize == 0) {
 	 yyFileStackSize = yyInitFileStackSize;
@@ -13,20 +13,72 @@
 
 /* code to be put into Scanner.h */
 
+# include <stddef.h>
+# include <stdint.h>
 # include "Position.h"
 
+/* 64 bit input.
+ * l_scan_BeginMemoryL scans `Length' bytes at `Text', the length is not
+ * limited to the range of int. l_scan_TokenOffset is the offset of the
+ * current token in the current source, counted in 64 bits like all other
+ * offsets of this scanner, independent of the size of long.
+ */
+typedef int64_t l_scan_tOffset;
+
+extern l_scan_tOffset l_scan_TokenOffset;
+extern void l_scan_BeginMemoryL (char * Text, size_t Length);
+
+/* Checkpoints.
+ * l_scan_Checkpoint stores the state of the scanner between two tokens in
+ * `*Blob': start states, nesting depth of comments, line, column and the
+ * offset of the next character. It fails (returns 0) within include files.
+ * l_scan_RestoreMemory resp. l_scan_RestoreFile begin to scan the given
+ * input (the same one the checkpoint was taken from) at the offset of the
+ * checkpoint, in the state of the checkpoint. RestoreFile returns 0 if the
+ * file cannot be positioned.
+ * The blob is plain data, it may be copied, written to a file, or passed
+ * to another process.
+ */
+# define l_scan_CheckpointSize	64
+
+typedef struct { int64_t Data [l_scan_CheckpointSize / 8]; } l_scan_tCheckpoint;
+
+extern int  l_scan_Checkpoint (l_scan_tCheckpoint * Blob);
+extern void l_scan_RestoreMemory (l_scan_tCheckpoint * Blob, char * Text, size_t Length);
+extern int  l_scan_RestoreFile (l_scan_tCheckpoint * Blob, char * FileName);
+extern l_scan_tOffset l_scan_CheckpointOffset (l_scan_tCheckpoint * Blob);
+extern unsigned int   l_scan_CheckpointLine (l_scan_tCheckpoint * Blob);
+
+/* Token values are views: `Ptr' points to the `Length' characters of the
+ * value, which are not terminated by a null character.
+ * If the input is a block of memory (l_scan_BeginMemory/N/L, include files
+ * and files which can be mapped into memory, see l_scan_BeginFile and
+ * l_scan_BeginMappedFile) `Ptr' points into the input itself and nothing is
+ * copied. Only input which is read (standard input, pipes, devices) has its
+ * values copied into a pool, since the input buffer is reused.
+ * The views stay valid until the input is released (ReleaseIncludes for
+ * mapped files) resp. until l_scan_ReleaseViews releases the pool.
+ * l_scan_Materialize returns a malloc'ed, null terminated copy of a view.
+ */
+typedef struct { char * Ptr; int Length; } l_scan_tView;
+
+extern int    l_scan_BeginMappedFile (char * FileName);
+extern char * l_scan_Materialize (l_scan_tView View);
+extern void   l_scan_ReleaseViews (void);
+
 /* Token Attributes.
  * For each token with user defined attributes, we need a typedef for the
  * token attributes.
  * The first struct-field must be of type tPosition!
  */
-typedef struct {tPosition Pos; char* Value;} tint_const;
-typedef struct {tPosition Pos; char* Value;} tfloat_const;
-typedef struct {tPosition Pos; char* Value;} tstring_const;
-typedef struct {tPosition Pos; char* Value;} tidentifier_const;
-typedef struct {tPosition Pos; char* Value;} toperator_const;
-typedef struct {tPosition Pos; char* Value;} tcomment_const;
-typedef struct {tPosition Pos; char* Value;} tbegin_const;
+typedef struct {tPosition Pos; l_scan_tView Value;} tint_const;
+typedef struct {tPosition Pos; l_scan_tView Value;} tfloat_const;
+typedef struct {tPosition Pos; l_scan_tView Value;} tstring_const;
+typedef struct {tPosition Pos; l_scan_tView Value;} tidentifier_const;
+typedef struct {tPosition Pos; l_scan_tView Value;} toperator_const;
+typedef struct {tPosition Pos; l_scan_tView Value;} tcomment_const;
+typedef struct {tPosition Pos; l_scan_tView Value;} tbegin_const;
+typedef struct {tPosition Pos; int Count;} tillegal_const;
 
 /* There is only one "actual" token, during scanning. Therfore
  * we use a UNION of all token-attributes as data type for that unique
@@ -42,6 +94,7 @@ typedef union {
   tstring_const string_const;
   tidentifier_const identifier_const;
   toperator_const operator_const;
+  tillegal_const illegal_const;
 } l_scan_tScanAttribute;
 
 /* Tokens are coded as int's, with values >=0
@@ -54,8 +107,85 @@ typedef union {
 # define tok_operator_const	5
 # define tok_comment_const	6
 # define tok_begin_const	7
+# define tok_illegal_const	8
+
+# define l_scan_MaxToken	tok_illegal_const	/* the highest token code */
+
+/* Input buffer.
+ * The buffer is allocated with yyInitBufferSize characters (64 KB, may be
+ * overridden by -DyyInitBufferSize=...), include files get one just big
+ * enough for them. Comments and strings are scanned in bulk and never grow
+ * it. A token which does not fit makes the frame double the buffer. Once
+ * the buffer holds as much of a token as the limit set by
+ * l_scan_SetBufferLimit (16 MB by default, 0 means no limit), no more
+ * input is read for it: the token is reported and returned as one
+ * tok_illegal_const (Pos = its start, Count = its length, at most
+ * INT_MAX), and the rest of it is skipped without being kept in the
+ * buffer. So the buffer grows to about twice the limit at most.
+ */
+extern void l_scan_SetBufferLimit (unsigned long Size);
+
+/* Streaming of long lexemes.
+ * If a chunk handler is set for tok_string_const or tok_comment_const, the
+ * body of every string resp. comment is passed to it in chunks, as soon as
+ * it has been scanned, instead of being collected in the token attribute:
+ * the scanner then needs constant memory, regardless of the length of the
+ * lexeme. Escape sequences of strings are passed decoded, the body of a
+ * nested comment is passed including the inner delimiters. The last call
+ * for a lexeme has `Last' set (and may have `Length' 0). For a line
+ * comment, tok_comment_const is returned at its start, so the remaining
+ * chunks of a long line may arrive during the next call of l_scan_GetToken.
+ * The value of a streamed string token is empty (Ptr NULL).
+ * The handler 0 switches streaming off again.
+ * l_scan_SetChunkHandler returns 0 if `Token' is not a token code.
+ */
+typedef void (* l_scan_tChunkHandler) (int Token, char * Chunk, int Length,
+				       int Last, void * Data);
+extern int l_scan_SetChunkHandler (int Token, l_scan_tChunkHandler Handler,
+				   void * Data);
+
+/* Recovery from illegal characters.
+ * A run of characters which cannot start any token is reported by one
+ * message, which gives the number of characters and the column range.
+ * If l_scan_SetIllegalToken (1) has been called, the run is returned as
+ * token tok_illegal_const (Pos = start, Count = number of characters),
+ * otherwise it is skipped.
+ * A run which continues across a refill of the buffer is still one run.
+ * After `Budget' such runs of one input scanning is aborted via l_scan_Exit,
+ * so garbage input can be made to fail quickly. The budget 0 (the default)
+ * means no limit. The count starts anew with every l_scan_Begin... call,
+ * except for include files.
+ */
+extern void l_scan_SetIllegalToken (int Return);
+extern void l_scan_SetErrorBudget (int Budget);
+
+/* Trivia: comments and white space.
+ * l_scan_TriviaToken: line comments are returned as tok_comment_const
+ *                     (the default)
+ * l_scan_TriviaSkip:  comments are skipped like white space
+ * l_scan_TriviaKeep:  comments are skipped, but every comment and every run
+ *                     of white space is recorded as (source, offset, length),
+ *                     nothing is copied.
+ * l_scan_Trivia returns the number of trivia in front of the last token
+ * returned (in mode l_scan_TriviaKeep), and the array in `*Trivia'. It is
+ * valid up to the next call of l_scan_GetToken.
+ * The sources are numbered from 0 in the order in which they are begun,
+ * include files too. l_scan_SourceName returns the name of the file of a
+ * source, NULL for standard input and memory.
+ * Only mode l_scan_TriviaKeep scans white space by rules of its own, the
+ * other modes leave it to the builtin actions of the scanner.
+ */
+# define l_scan_TriviaToken	0
+# define l_scan_TriviaSkip	1
+# define l_scan_TriviaKeep	2
+
+typedef struct { int Source; l_scan_tOffset Offset; l_scan_tOffset Length; } l_scan_tTrivia;
+
+extern void   l_scan_SetTriviaMode (int Mode);
+extern int    l_scan_Trivia (l_scan_tTrivia ** Trivia);
+extern char * l_scan_SourceName (int Source);
 
-/* line 58 "l_scan.h" */
+/* line 188 "l_scan.h" */
 
 # define l_scan_EofToken	0
 # define l_scan_xxMaxCharacter	255
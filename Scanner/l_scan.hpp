@@ -0,0 +1,379 @@
+/* Project:  COCKTAIL training
+ * Descr:    a simple scanner generated with rex
+ * Kind:     header-only C++ scanner over the tables emitted by rex2cpp
+ *
+ * The DFA of l.rex is taken from l_scan_tables.hpp (see rex2cpp.c), the rule
+ * actions are supplied as a callback, so the compiler can inline them into
+ * the scanning loop:
+ *
+ *   struct actions : l_scan::default_actions<> {
+ *     template <typename Scanner>
+ *     int operator () (Scanner & s, int rule, std::string_view text) {
+ *       switch (rule) {
+ *       case l_scan::rule_identifier: ... return l_scan::identifier_const;
+ *       ...
+ *       default: return default_actions::operator () (s, rule, text);
+ *       }
+ *     }
+ *   };
+ *
+ *   for (auto tok : l_scan::basic_scanner<char, actions> (input))
+ *     ... tok.kind, tok.text, tok.line, tok.column ...
+ *
+ * `rule' is the number of the matching rule, named rule_<id> by the comment
+ * "rule <id>" in its action in l.rex, rule_default if no rule matches (then
+ * the text is the offending character). The callback returns the token
+ * kind, or 0 to continue scanning. Blanks, tabs and newlines not matched by
+ * a rule are skipped and counted like the C scanner does it. At the end of
+ * every input the scanner calls end_of_input (s) of the callback.
+ *
+ * Messages are collected by the scanner (see error and messages) instead of
+ * being printed, a fatal one ends the scan like it ends the C scanner.
+ */
+
+# ifndef l_scan_HPP
+# define l_scan_HPP
+
+# include <cstddef>
+# include <cstdio>
+# include <fstream>
+# include <iterator>
+# include <list>
+# include <string>
+# include <string_view>
+# include <type_traits>
+# include <vector>
+
+# include "l_scan_tables.hpp"
+
+namespace l_scan {
+
+/* The default actions: the start states of l.rex for comments and strings,
+ * its include files and fatal errors, and the token the rule returns in
+ * l.rex, everything else is skipped. l.rex skips the bodies in bulk, here
+ * they are matched rule by rule, so their lines and tabs are counted here.
+ * The included files are read into `files', the tokens point into them.
+ */
+template <typename Tables = tables>
+struct default_actions {
+  static constexpr std::size_t max_include_depth = 200;	// as in l.rex
+
+  int				nesting = 0;	// of (# ... #) comments
+  std::vector<std::string>	directories { std::string () };	// of the inputs
+  std::list<std::string>	files;
+
+  default_actions () = default;
+
+  // `file_name' is the name of the input, included files are looked up
+  // relative to its directory
+  explicit default_actions (const std::string & file_name)
+    : directories { directory_of (file_name) } {}
+
+  template <typename Scanner, typename Text>
+  int operator () (Scanner & s, int rule, Text text)
+  {
+    switch (rule) {
+    case rule_line_comment:	s.start (LCOM); break;
+    case rule_line_comment_end:	s.count (text); s.start (STD); break;
+    case rule_comment:		s.start (COM); nesting = 1; break;
+    case rule_comment_nested:	++ nesting; break;
+    case rule_comment_end:	if (-- nesting == 0) s.start (STD); break;
+    case rule_string:		s.start (STR); break;
+    case rule_string_end:	s.start (STD); break;
+    case rule_string_newline:
+      s.error ("Panic! no linebreaks within a string...", true);
+      break;
+    case rule_include:		include (s, text); break;
+    case rule_white_space:
+    case rule_line_comment_body:
+    case rule_comment_body:	s.count (text); break;
+    }
+    return Tables::rule_token [rule];
+  }
+
+  template <typename Scanner>
+  void end_of_input (Scanner & s)
+  {
+    if (s.start_state () == STR)
+      s.error ("Panic! You opend a String but never closed it!", true);
+    else if (s.start_state () == COM)
+      s.error ("Panic! You opend a Comment but never closed it!", true);
+    if (s.depth () > 0) directories.pop_back ();
+  }
+
+private:
+  // Returns the directory of `file_name' with a trailing "/", "" for "."
+  static std::string directory_of (const std::string & file_name)
+  {
+    std::size_t slash = file_name.rfind ('/');
+    return slash == std::string::npos ? std::string () : file_name.substr (0, slash + 1);
+  }
+
+  // Scans the file named in the directive `text' in place of the directive
+  template <typename Scanner, typename Text>
+  void include (Scanner & s, Text text)
+  {
+    if constexpr (std::is_same_v<typename Text::value_type, char>) {
+      std::size_t first = text.find ('"'), last = text.find ('"', first + 1);
+      std::string name (text.substr (first + 1, last - first - 1));
+      std::string path = name [0] == '/' ? name : directories.back () + name;
+      if (s.depth () >= max_include_depth) {
+	s.error ("Include files nested too deeply");
+	return;
+      }
+      std::ifstream file (path, std::ios::binary);
+      if (! file) {
+	s.error ("Cannot open include file " + name);
+	return;
+      }
+      files.emplace_back (std::istreambuf_iterator<char> (file),
+			  std::istreambuf_iterator<char> ());
+      directories.push_back (directory_of (path));
+      s.include (files.back ());
+    } else {
+      s.error ("Include files need an input of char");
+    }
+  }
+};
+
+/* Profiles of the state visits: no_profile costs nothing, state_profile
+ * counts every transition. The counts written by state_profile::write are
+ * read by rex2cpp -p to renumber and pack the states hottest first.
+ */
+struct no_profile {
+  void count (int) {}
+};
+
+template <typename Tables = tables>
+struct state_profile {
+  unsigned long visits [Tables::state_count + 1] = {};
+
+  void count (int state) { ++ visits [state]; }
+
+  void write (std::FILE * file) const
+  {
+    for (int s = 1; s <= Tables::state_count; s ++)
+      if (visits [s] != 0) std::fprintf (file, "%d %lu\n", s, visits [s]);
+  }
+};
+
+template <typename CharT, typename Callback = default_actions<>,
+	  typename Tables = tables, int TabSpace = 8,
+	  typename Profile = no_profile>
+class basic_scanner {
+  static_assert ((TabSpace & (TabSpace - 1)) == 0, "TabSpace must be a power of 2");
+
+public:
+  using char_type   = CharT;
+  using string_view = std::basic_string_view<CharT>;
+
+  struct token {
+    int		kind;		// token_kind, eof at end of input
+    string_view	text;
+    unsigned	line;
+    int		column;
+    std::size_t	offset;		// in the current input
+  };
+
+  struct message {
+    std::string	text;
+    bool	fatal;
+    unsigned	line;
+    int		column;
+  };
+
+  class sentinel {};
+
+  class iterator {
+  public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type        = token;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const token *;
+    using reference         = const token &;
+
+    explicit iterator (basic_scanner * s) : scanner_ (s), token_ (s->next ()) {}
+
+    reference  operator *  () const { return token_; }
+    pointer    operator -> () const { return & token_; }
+    iterator & operator ++ ()       { token_ = scanner_->next (); return * this; }
+    void       operator ++ (int)    { ++ * this; }
+
+    friend bool operator == (const iterator & i, sentinel) { return i.token_.kind == eof; }
+    friend bool operator != (const iterator & i, sentinel) { return i.token_.kind != eof; }
+
+  private:
+    basic_scanner * scanner_;
+    token	    token_;
+  };
+
+  explicit basic_scanner (string_view input, Callback callback = Callback (),
+			  int start_state = STD)
+    : input_ (input), callback_ (callback),
+      initial_ (start_state), start_ (start_state), previous_ (start_state) {}
+
+  iterator begin () { return iterator (this); }
+  sentinel end   () { return sentinel (); }
+
+  // like yyStart and yyPrevious of the C scanner
+  void start (int state) { previous_ = start_; start_ = state; }
+  void previous ()       { int s = start_; start_ = previous_; previous_ = s; }
+  int  start_state () const { return start_; }
+
+  // Continues scanning at `offset' (>= the current one), e.g. after a
+  // callback skipped a comment body; lines are counted on the way.
+  void skip_to (std::size_t offset)
+  {
+    for (; pos_ < offset; ++ pos_) {
+      if (input_ [pos_] == CharT ('\n')) { ++ line_; line_start_ = (long) pos_; }
+      else if (input_ [pos_] == CharT ('\t')) tab (pos_);
+    }
+  }
+
+  // Counts the lines and tabs of `text', the text of the rule just matched,
+  // which ends at the current offset.
+  void count (string_view text)
+  {
+    std::size_t at = pos_ - text.size ();
+    for (std::size_t i = 0; i < text.size (); ++ i, ++ at) {
+      if (text [i] == CharT ('\n')) { ++ line_; line_start_ = (long) at; }
+      else if (text [i] == CharT ('\t')) tab (at);
+    }
+  }
+
+  // Scans `input' from line 1 in the initial start state, then continues
+  // after the rule just matched. `input' has to live as long as its tokens.
+  void include (string_view input)
+  {
+    inputs_.push_back (saved_input { input_, pos_, line_, line_start_, start_, previous_ });
+    input_ = input; pos_ = 0; line_ = 1; line_start_ = -1;
+    start_ = previous_ = initial_;
+  }
+
+  // Reports `text' at the start of the rule just matched, in end_of_input
+  // at the end of the input. A fatal message ends the scan.
+  void error (std::string text, bool fatal = false)
+  {
+    messages_.push_back (message { std::move (text), fatal, message_line_, message_column_ });
+    if (fatal) done_ = true;
+  }
+
+  const std::vector<message> & messages () const { return messages_; }
+
+  std::size_t offset () const { return pos_; }
+  unsigned    line   () const { return line_; }
+  std::size_t depth  () const { return inputs_.size (); }	// of includes
+  string_view rest   () const { return input_.substr (pos_); }
+
+  const Profile & profile () const { return profile_; }
+
+  // Returns the next token, eof at end of input.
+  token next ()
+  {
+    if (done_) return eof_token ();
+    for (;;) {
+      if (pos_ == input_.size ()) {
+	message_line_   = line_;
+	message_column_ = column (pos_);
+	callback_.end_of_input (* this);
+	if (done_ || inputs_.empty ()) break;
+	const saved_input & i = inputs_.back ();
+	input_ = i.input; pos_ = i.pos; line_ = i.line; line_start_ = i.line_start;
+	start_ = i.start; previous_ = i.previous;
+	inputs_.pop_back ();
+	continue;
+      }
+      const std::size_t size = input_.size ();
+      std::size_t p = pos_, last_pos = pos_;
+      int state = start_, last_action = Tables::action_none;
+
+      for (;;) {			// as many state transitions as possible
+	if (p == size) break;
+	const auto ch = static_cast<std::make_unsigned_t<CharT>> (input_ [p]);
+	if (ch > Tables::max_character) break;
+	const int cl = Tables::char_class [ch];	// folded with rex2cpp -i
+	const int from = state;
+	int t;
+	while (Tables::comb [t = Tables::base [state] + cl].check != state)
+	  if ((state = Tables::default_state_of [state]) == 0) goto done;
+	state = Tables::comb [t].next;
+	if (state == Tables::eob_state) {	// a real DEL character
+	  if ((state = Tables::eob_trans [from]) == 0) break;
+	}
+	profile_.count (state);
+	++ p;
+	if (Tables::action [state] != Tables::action_none) {
+	  last_action = Tables::action [state];
+	  last_pos    = p;
+	}
+      }
+    done:
+      switch (last_action) {
+      case Tables::action_blank:
+	pos_ = last_pos;
+	while (pos_ < size && input_ [pos_] == CharT (' ')) ++ pos_;
+	continue;
+      case Tables::action_tab:
+	tab (pos_);
+	pos_ = last_pos;
+	continue;
+      case Tables::action_eol:
+	++ line_;
+	line_start_ = (long) last_pos - 1;
+	pos_ = last_pos;
+	continue;
+      case Tables::action_none:		// no rule matches: default action
+	last_pos = pos_ + 1;
+	/* fall through */
+      default: {
+	token tok { 0, input_.substr (pos_, last_pos - pos_), line_,
+		    column (pos_), pos_ };
+	message_line_   = tok.line;
+	message_column_ = tok.column;
+	pos_ = last_pos;
+	tok.kind = callback_ (* this, last_action, tok.text);
+	if (done_) return eof_token ();
+	if (tok.kind != 0) return tok;
+      }
+      }
+    }
+    done_ = true;
+    return eof_token ();
+  }
+
+private:
+  struct saved_input {
+    string_view	input;
+    std::size_t	pos;
+    unsigned	line;
+    long	line_start;
+    int		start, previous;
+  };
+
+  int column (std::size_t at) const { return (int) ((long) at - line_start_); }
+
+  token eof_token () const { return token { eof, string_view (), line_, column (pos_), pos_ }; }
+
+  void tab (std::size_t at)
+  { line_start_ -= (TabSpace - 1 - ((long) at - line_start_ - 1)) & (TabSpace - 1); }
+
+  string_view	input_;
+  Callback	callback_;
+  Profile	profile_;
+  std::size_t	pos_        = 0;
+  unsigned	line_       = 1;
+  long		line_start_ = -1;	// offset of the last '\n', column = offset - line_start_
+  int		initial_, start_, previous_;
+  std::vector<saved_input> inputs_;	// the including inputs
+  std::vector<message>	messages_;
+  unsigned	message_line_   = 1;
+  int		message_column_ = 0;
+  bool		done_ = false;		// eof or a fatal message
+};
+
+template <typename Callback = default_actions<>>
+using scanner = basic_scanner<char, Callback>;
+
+} // namespace l_scan
+
+# endif
@@ -10,44 +10,117 @@
 # include <string.h>
 # include "Position.h"
 # include "l_scan.h"
+# include "include.h"
+# include "resync.h"
+# include "tokindex.h"
+
+/* Print the comments and white space in front of the current token */
+static void PrintTrivia (void)
+{
+   l_scan_tTrivia * Trivia;
+   int n = l_scan_Trivia (& Trivia), i;
+   for (i = 0; i < n; i ++)
+     printf ("trivia       : source %d, offset %lld, length %lld\n", Trivia[i].Source,
+	     (long long) Trivia[i].Offset, (long long) Trivia[i].Length);
+}
 
 int main (int argc, char *argv[])
 {
-   int Token, Count = 0;
-   if (argc == 2) {
-     if (strcmp (argv[1], "-h") == 0) {
+   int Token, Count = 0, i;
+   int ShowTrivia = 0;
+   char * WriteIndex = NULL, * ReadIndex = NULL;
+   long Interval = DEFAULT_RESYNC_INTERVAL;
+   unsigned long FromLine = 0, ToLine = 0;
+   for (i = 1; i < argc && argv[i][0] == '-'; i ++) {
+     if (strcmp (argv[i], "-x") == 0 && i + 2 < argc) {
+       if (! BuildTokenIndex (argv[i + 1], argc - i - 2, argv + i + 2)) {
+	 fprintf (stderr, "scan: cannot create index %s\n", argv[i + 1]);
+	 exit (1);
+       }
+       exit (0);
+     } else if (strcmp (argv[i], "-q") == 0 && i + 2 < argc) {
+       long n = QueryTokenIndex (argv[i + 1], argv[i + 2], stdout);
+       if (n < 0) {
+	 fprintf (stderr, "scan: cannot read index %s\n", argv[i + 1]);
+	 exit (1);
+       }
+       exit (n > 0 ? 0 : 2);
+     } else if (strcmp (argv[i], "-w") == 0 && i + 1 < argc) {
+       WriteIndex = argv[++ i];
+     } else if (strcmp (argv[i], "-n") == 0 && i + 1 < argc) {
+       Interval = atol (argv[++ i]) * 1024;
+     } else if (strcmp (argv[i], "-r") == 0 && i + 2 < argc &&
+		sscanf (argv[i + 2], "%lu-%lu", & FromLine, & ToLine) == 2) {
+       ReadIndex = argv[i + 1];
+       i += 2;
+     } else if (strcmp (argv[i], "-s") == 0) {
+       l_scan_SetTriviaMode (l_scan_TriviaSkip);
+     } else if (strcmp (argv[i], "-t") == 0) {
+       l_scan_SetTriviaMode (l_scan_TriviaKeep);
+       ShowTrivia = 1;
+     } else {
        fprintf (stderr,
-		"usage: scan [-h] [file]\n"
+		"usage: scan [-h] [-s | -t] [-w index [-n kb] | -r index from-to] [file]\n"
+		"       scan -x index file...\n"
+		"       scan -q index name\n"
 		"  simple scanner, reads `file' or stdin\n"
-		"  -h: Help\n");
-       exit (0);
+		"  -h: Help\n"
+		"  -s: skip comments\n"
+		"  -t: skip comments, list comments and white space as trivia\n"
+		"  -w: write a resynchronization index, an entry every `kb' KB (64)\n"
+		"  -r: scan the lines `from' to `to' of `file' only, using its index\n"
+		"  -x: write an index of the identifiers and keywords of the files\n"
+		"  -q: list the occurrences of `name' in such an index as `file offset'\n");
+       exit (strcmp (argv[i], "-h") == 0 ? 0 : 1);
      }
-     l_scan_BeginFile (argv[1]);
-     /* Read from file argv[1].
-      * If this routine is not called, stdin is read.
+   }
+   if (ReadIndex != NULL) {
+     if (i == argc || ! BeginRange (argv[i], ReadIndex, FromLine)) {
+       fprintf (stderr, "scan: cannot use index %s\n", ReadIndex);
+       exit (1);
+     }
+   } else if (i < argc && ! l_scan_BeginMappedFile (argv[i])) {
+     l_scan_BeginFile (argv[i]);
+     /* Read from file argv[i], if it cannot be mapped into memory.
+      * If neither routine is called, stdin is read.
       */
    }
+   if (WriteIndex != NULL && ! BeginResyncIndex (i < argc ? argv[i] : NULL, WriteIndex, Interval)) {
+     fprintf (stderr, "scan: cannot create index %s\n", WriteIndex);
+     exit (1);
+   }
    for (Token =  l_scan_GetToken ();
 	Token != l_scan_EofToken;
 	Token = l_scan_GetToken ()) {
+      if (ReadIndex != NULL) {
+	if (l_scan_Attribute.Position.Line > ToLine) break;
+	if (l_scan_Attribute.Position.Line < FromLine) continue;
+      }
+      if (WriteIndex != NULL) ResyncPoint ();
       Count ++;
+      if (ShowTrivia) PrintTrivia ();
       WritePosition (stdout, l_scan_Attribute.Position); printf (" ");
       switch (Token) {
       case tok_int_const:
-	printf ("int_const    : %s\n",l_scan_Attribute.int_const.Value);
+	printf ("int_const    : %.*s\n", l_scan_Attribute.int_const.Value.Length,
+		l_scan_Attribute.int_const.Value.Ptr);
 	break;
 	/* add code to emit your tokens here */
       case tok_float_const:
-	printf ("float_const    : %s\n",l_scan_Attribute.float_const.Value);
+	printf ("float_const    : %.*s\n", l_scan_Attribute.float_const.Value.Length,
+		l_scan_Attribute.float_const.Value.Ptr);
 	break;
       case tok_string_const:
-	printf ("string_const    : %s\n",l_scan_Attribute.string_const.Value);
+	printf ("string_const    : %.*s\n", l_scan_Attribute.string_const.Value.Length,
+		l_scan_Attribute.string_const.Value.Ptr);
 	break;
       case tok_identifier_const:
-	printf ("identifier_const    : %s\n",l_scan_Attribute.identifier_const.Value);
+	printf ("identifier_const    : %.*s\n", l_scan_Attribute.identifier_const.Value.Length,
+		l_scan_Attribute.identifier_const.Value.Ptr);
 	break;
       case tok_operator_const:
-	printf ("operator_const    : %s\n",l_scan_Attribute.operator_const.Value);
+	printf ("operator_const    : %.*s\n", l_scan_Attribute.operator_const.Value.Length,
+		l_scan_Attribute.operator_const.Value.Ptr);
 	break;
       case tok_comment_const:
 	printf ("comment_const \n");
@@ -55,9 +128,16 @@ int main (int argc, char *argv[])
       case tok_begin_const:
 	printf ("begin_const\n");
 	break;
+      case tok_illegal_const:
+	printf ("illegal_const    : %d characters\n",l_scan_Attribute.illegal_const.Count);
+	break;
       default: fprintf (stderr, "FATAL ERROR, unknown token\n");
       }
    }
+   if (ShowTrivia) PrintTrivia ();
    printf ("Token count: %d\n", Count);
+   EndResyncIndex ();
+   l_scan_ReleaseViews ();
+   ReleaseIncludes ();
    return 0;
 }
@@ -0,0 +1,59 @@
+/* Project:  COCKTAIL training
+ * Descr:    a simple scanner generated with rex
+ * Kind:     C++ main function: the scanner of l_scan.hpp, for `make cxxtest'
+ *
+ * Prints the position and the kind of every token of `file' in the format
+ * of main.c, without the values, and the messages in the format of the
+ * reuse library, so both scanners can be compared.
+ */
+
+# include <cstdio>
+# include <fstream>
+# include <iterator>
+# include <string>
+# include "l_scan.hpp"
+
+static const char * Kind (int kind)
+{
+  switch (kind) {
+  case l_scan::int_const:	 return "int_const";
+  case l_scan::float_const:	 return "float_const";
+  case l_scan::string_const:	 return "string_const";
+  case l_scan::identifier_const: return "identifier_const";
+  case l_scan::operator_const:	 return "operator_const";
+  case l_scan::comment_const:	 return "comment_const";
+  case l_scan::begin_const:	 return "begin_const";
+  case l_scan::illegal_const:	 return "illegal_const";
+  default:			 return "FATAL ERROR, unknown token";
+  }
+}
+
+int main (int argc, char * argv [])
+{
+  if (argc != 2) {
+    std::fprintf (stderr, "usage: scan_cxx file\n");
+    return 1;
+  }
+  std::ifstream file (argv [1], std::ios::binary);
+  if (! file) {
+    std::perror (argv [1]);
+    return 1;
+  }
+  std::string input ((std::istreambuf_iterator<char> (file)),
+		     std::istreambuf_iterator<char> ());
+  l_scan::scanner<> scanner (input, l_scan::default_actions<> (argv [1]));
+  int count = 0;
+  for (auto tok : scanner) {
+    std::printf ("%3u,%2d %s\n", tok.line, tok.column, Kind (tok.kind));
+    ++ count;
+  }
+  bool fatal = false;
+  for (auto & m : scanner.messages ()) {
+    std::fprintf (stderr, "%3u,%2d: %-8s %s\n", m.line, m.column,
+		  m.fatal ? "Fatal" : "Error", m.text.c_str ());
+    fatal |= m.fatal;
+  }
+  if (fatal) return 1;		/* like Message (..., xxFatal, ...) */
+  std::printf ("Token count: %d\n", count);
+  return 0;
+}
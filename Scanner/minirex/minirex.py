@@ -0,0 +1,537 @@
+#!/usr/bin/env python3
+"""minirex: generates the scanner of a rex specification.
+
+usage: minirex.py [-a] spec.rex [directory]
+
+Reads the specification the way `rex -cdis -y' does and writes <Scanner>.c
+and <Scanner>.h into `directory' (default .), using the frames frame.c and
+frame.h next to this file. These are the C frames of rex (Scanner.c 2.67,
+Scanner.h 2.18) with the generated parts replaced by @...@ markers, so the
+scanner is the one rex would generate: the same interface, the same comb
+vector tables (which rex2cpp reads) and the same actions. The Source
+module (<Scanner>Source.c/.h) is not generated, it is kept in the tree.
+
+Supported: the sections SCANNER, EXPORT, GLOBAL, LOCAL, BEGIN, CLOSE,
+DEFAULT, EOF, DEFINE, START and RULE(S); start state lists #S, ...#, rules
+at the beginning of a line (<), character sets {..} and -{..}, strings,
+escapes, ANY, and the operators | * + ? ( ). Trailing context (/) is not.
+
+-a  the scanner remembers only the last final state passed and the position
+    behind it, like flex, instead of pushing every state onto a stack that
+    grows with the token. It needs one table (yyFinal) more. Without
+    trailing context no rule needs the stack, so this is all or nothing.
+"""
+import re, sys, os
+
+EOB = 127
+ALL = frozenset(range(256))
+ANY = ALL - {10}
+
+# ---------------------------------------------------------------- spec
+KEYWORDS = ('SCANNER', 'EXPORT', 'GLOBAL', 'LOCAL', 'BEGIN', 'CLOSE',
+            'DEFAULT', 'EOF', 'DEFINE', 'START', 'RULE', 'RULES')
+
+class Spec:
+    pass
+
+def skip_ws(t, i):
+    while i < len(t):
+        if t[i].isspace(): i += 1
+        elif t.startswith('/*', i): i = t.index('*/', i) + 2
+        elif t.startswith('//', i):
+            j = t.find('\n', i); i = len(t) if j < 0 else j
+        else: break
+    return i
+
+def code_block(t, i):
+    """t[i] == '{': return (inner, end index after '}')"""
+    assert t[i] == '{', t[i:i+40]
+    depth = 0; j = i
+    while True:
+        c = t[j]
+        if t.startswith('/*', j): j = t.index('*/', j) + 2; continue
+        if t.startswith('//', j): j = t.index('\n', j); continue
+        if c in '"\'':
+            k = j + 1
+            while t[k] != c:
+                k += 2 if t[k] == '\\' else 1
+            j = k + 1; continue
+        if c == '{': depth += 1
+        elif c == '}':
+            depth -= 1
+            if depth == 0: return t[i+1:j], j + 1
+        j += 1
+
+def lineno(t, i): return t.count('\n', 0, i) + 1
+
+ESC = {'n': 10, 't': 9, 'r': 13, 'b': 8, 'f': 12, 'v': 11, 'a': 7}
+
+def esc_char(t, i):
+    """t[i] == '\\': return (code, next)"""
+    c = t[i+1]
+    if c in ESC: return ESC[c], i + 2
+    if c.isdigit():
+        j = i + 1
+        while j < len(t) and j < i + 4 and t[j] in '01234567': j += 1
+        return int(t[i+1:j], 8), j
+    return ord(c), i + 2
+
+class RP:
+    """rex regular expression parser"""
+    def __init__(s, t, i, defs, stop):
+        s.t, s.i, s.defs, s.stop = t, i, defs, stop
+    def ws(s):
+        while s.i < len(s.t) and s.t[s.i] in ' \t\r\n': s.i += 1
+        # comments inside patterns
+        if s.t.startswith('/*', s.i):
+            s.i = s.t.index('*/', s.i) + 2; s.ws()
+    def peek(s):
+        s.ws(); return s.t[s.i] if s.i < len(s.t) else ''
+    def alt(s):
+        a = s.cat()
+        while s.peek() == '|':
+            s.i += 1; a = ('alt', a, s.cat())
+        return a
+    def cat(s):
+        a = None
+        while True:
+            c = s.peek()
+            if c == '' or c in '|)' or s.at_stop(): break
+            b = s.post()
+            a = b if a is None else ('cat', a, b)
+        return a if a is not None else ('eps',)
+    def at_stop(s):
+        c = s.peek()
+        if c == ':' and s.stop == ':': return True
+        if c == '.' and s.stop == '.': return True
+        return False
+    def post(s):
+        a = s.atom()
+        while True:
+            c = s.peek()
+            if c == '*': s.i += 1; a = ('star', a)
+            elif c == '+': s.i += 1; a = ('plus', a)
+            elif c == '?': s.i += 1; a = ('opt', a)
+            else: return a
+    def atom(s):
+        t = s.t; c = s.peek()
+        if c == '(':
+            s.i += 1; a = s.alt(); assert s.peek() == ')', t[s.i:s.i+30]; s.i += 1; return a
+        if c == '"':
+            j = s.i + 1; chars = []
+            while t[j] != '"':
+                if t[j] == '\\': ch, j = esc_char(t, j)
+                else: ch = ord(t[j]); j += 1
+                chars.append(ch)
+            s.i = j + 1
+            return lit(chars)
+        if c == '\\':
+            ch, s.i = esc_char(t, s.i); return ('set', frozenset([ch]))
+        if c == '{':
+            return ('set', s.cset())
+        if c == '-':
+            s.i += 1; assert s.peek() == '{'; return ('set', ALL - s.cset())
+        m = re.compile(r'[A-Za-z_][A-Za-z_0-9]*').match(t, s.i)
+        if m:
+            s.i = m.end(); w = m.group(0)
+            if w == 'ANY': return ('set', ANY)
+            if w in s.defs: return s.defs[w]
+            return lit([ord(x) for x in w])
+        m = re.compile(r'[0-9]+').match(t, s.i)
+        if m:
+            s.i = m.end(); return lit([ord(x) for x in m.group(0)])
+        raise SyntaxError('pattern at line %d: %r' % (lineno(t, s.i), t[s.i:s.i+30]))
+    def cset(s):
+        t = s.t; assert t[s.i] == '{'; j = s.i + 1; out = set()
+        def one(j):
+            if t[j] == '\\': return esc_char(t, j)
+            return ord(t[j]), j + 1
+        while True:
+            while t[j] in ' \t\n': j += 1
+            if t[j] == '}': break
+            a, j = one(j)
+            if t[j] == '-' and t[j+1] != '}':
+                b, j = one(j + 1); out.update(range(a, b + 1))
+            else: out.add(a)
+        s.i = j + 1
+        return frozenset(out)
+
+def lit(chars):
+    a = None
+    for ch in chars:
+        b = ('set', frozenset([ch]))
+        a = b if a is None else ('cat', a, b)
+    return a if a is not None else ('eps',)
+
+def const_string(ast):
+    """list of chars if ast is a constant string, else None"""
+    if ast[0] == 'set': return [next(iter(ast[1]))] if len(ast[1]) == 1 else None
+    if ast[0] == 'cat':
+        a, b = const_string(ast[1]), const_string(ast[2])
+        return a + b if a is not None and b is not None else None
+    return None
+
+def parse_spec(path):
+    t = open(path).read()
+    sp = Spec(); sp.path = os.path.basename(path)
+    sp.sections = {}; sp.defs = {}; sp.starts = ['STD']; sp.rules = []
+    i = 0
+    while True:
+        i = skip_ws(t, i)
+        if i >= len(t): break
+        m = re.compile(r'[A-Z]+').match(t, i)
+        assert m and m.group(0) in KEYWORDS, t[i:i+50]
+        kw = m.group(0); i = m.end()
+        if kw == 'SCANNER':
+            i = skip_ws(t, i); m = re.compile(r'\w+').match(t, i); sp.name = m.group(0); i = m.end()
+        elif kw in ('EXPORT', 'GLOBAL', 'LOCAL', 'BEGIN', 'CLOSE', 'DEFAULT', 'EOF'):
+            i = skip_ws(t, i); ln = lineno(t, i)
+            inner, i = code_block(t, i)
+            sp.sections[kw] = (ln, inner)
+        elif kw == 'DEFINE':
+            while True:
+                i = skip_ws(t, i)
+                m = re.compile(r'([A-Za-z_]\w*)\s*=').match(t, i)
+                if not m: break
+                p = RP(t, m.end(), sp.defs, '.')
+                sp.defs[m.group(1)] = p.alt()
+                assert p.peek() == '.'; i = p.i + 1
+        elif kw == 'START':
+            m = re.compile(r'[ \t]*(\w+(?:[ \t]*,[ \t]*\w+)*)').match(t, i)
+            sp.starts += [x.strip() for x in m.group(1).split(',')]; i = m.end()
+        else:  # RULE(S)
+            while True:
+                i = skip_ws(t, i)
+                if i >= len(t): break
+                states = None; bol = False
+                if t[i] == '#':
+                    j = t.index('#', i + 1)
+                    states = [x.strip() for x in t[i+1:j].split(',')]; i = j + 1
+                p = RP(t, i, sp.defs, ':')
+                if p.peek() == '<': p.i += 1; bol = True
+                ast = p.alt()
+                assert p.peek() == ':', t[p.i:p.i+40]; i = skip_ws(t, p.i + 1)
+                ln = lineno(t, i)
+                inner, i = code_block(t, i)
+                sp.rules.append(dict(states=states, bol=bol, ast=ast, line=ln,
+                                     action=inner, const=const_string(ast)))
+    return sp
+
+# ---------------------------------------------------------------- NFA/DFA
+class NFA:
+    def __init__(s): s.eps = []; s.tr = []; s.acc = {}
+    def new(s): s.eps.append([]); s.tr.append([]); return len(s.eps) - 1
+    def build(s, ast):
+        k = ast[0]
+        if k == 'eps':
+            a = s.new(); return a, a
+        if k == 'set':
+            a, b = s.new(), s.new(); s.tr[a].append((ast[1], b)); return a, b
+        if k == 'cat':
+            a1, b1 = s.build(ast[1]); a2, b2 = s.build(ast[2]); s.eps[b1].append(a2); return a1, b2
+        if k == 'alt':
+            a, b = s.new(), s.new()
+            for x in ast[1:]:
+                a1, b1 = s.build(x); s.eps[a].append(a1); s.eps[b1].append(b)
+            return a, b
+        a1, b1 = s.build(ast[1]); a, b = s.new(), s.new()
+        s.eps[a].append(a1); s.eps[b1].append(b)
+        if k in ('star', 'opt'): s.eps[a].append(b)
+        if k in ('star', 'plus'): s.eps[b1].append(a1)
+        return a, b
+    def closure(s, xs):
+        st = list(xs); out = set(xs)
+        while st:
+            x = st.pop()
+            for y in s.eps[x]:
+                if y not in out: out.add(y); st.append(y)
+        return frozenset(out)
+
+def generate(sp):
+    # rules: user rules, then builtin blank, tab, eol
+    rules = list(sp.rules)
+    for name, ch in (('blank', 32), ('tab', 9), ('eol', 10)):
+        rules.append(dict(states=None, bol=False, ast=('set', frozenset([ch])), line=None,
+                          builtin=name, const=[ch]))
+    nfa = NFA(); rstart = []
+    for r, rule in enumerate(rules):
+        a, b = nfa.build(rule['ast']); nfa.acc[b] = r; rstart.append(a)
+    nst = len(sp.starts)
+    # DFA
+    dstates = {}; dlist = []; dtrans = []
+    def dstate(key):
+        if key not in dstates:
+            dstates[key] = len(dlist); dlist.append(key); dtrans.append(None)
+        return dstates[key]
+    starts = []
+    for k, st in enumerate(sp.starts):
+        for bol in (False, True):
+            items = [rstart[r] for r, rule in enumerate(rules)
+                     if (rule['states'] is None or st in rule['states']) and (bol or not rule['bol'])]
+            starts.append(dstate(('start', 2 * k + 1 + bol, nfa.closure(items))))
+    work = 0
+    while work < len(dlist):
+        key = dlist[work]; items = key[2] if isinstance(key, tuple) else key
+        row = [0] * 256
+        nxt = {}
+        for x in items:
+            for cs, y in nfa.tr[x]:
+                for c in cs: nxt.setdefault(c, set()).add(y)
+        for c, ys in nxt.items():
+            row[c] = dstate(nfa.closure(ys)) + 1  # 1-based temp, 0 = none
+        dtrans[work] = row; work += 1
+    def action(key):
+        items = key[2] if isinstance(key, tuple) else key
+        rs = [nfa.acc[x] for x in items if x in nfa.acc]
+        return min(rs) if rs else None
+    n = len(dlist)
+    act = [None if isinstance(k, tuple) else action(k) for k in dlist]
+    # minimize (Moore), start states stay distinct
+    blk = []
+    for i, k in enumerate(dlist):
+        blk.append(('s', k[1]) if isinstance(k, tuple) else ('a', act[i]))
+    while True:
+        ids = {}; nb = []
+        for i in range(n):
+            sig = (blk[i], tuple(blk[dtrans[i][c] - 1] if dtrans[i][c] else None for c in range(256)))
+            nb.append(ids.setdefault(sig, len(ids)))
+        if len(set(nb)) == len(set(blk)): blk = nb; break
+        blk = nb
+    # representative per block
+    rep = {}
+    for i in range(n): rep.setdefault(blk[i], i)
+    # constant-ness: block is trie state if all items of its representative come from const rules
+    owner = {}
+    for r, rule in enumerate(rules):
+        # mark NFA states of rule r: reachable from rstart[r] without leaving the fragment
+        st = [rstart[r]]; seen = {rstart[r]}
+        while st:
+            x = st.pop(); owner[x] = r
+            for y in nfa.eps[x] + [y for _, y in nfa.tr[x]]:
+                if y not in seen: seen.add(y); st.append(y)
+    def is_trie(i):
+        k = dlist[i]
+        if isinstance(k, tuple): return False
+        return all(rules[owner[x]]['const'] is not None for x in k)
+    # numbering
+    num = {}
+    for i, s in enumerate(starts): num[blk[s]] = i + 1
+    order = []
+    from collections import deque
+    q = deque(blk[s] for s in starts); seen = set(q)
+    while q:
+        b = q.popleft(); i = rep[b]
+        for c in range(256):
+            if dtrans[i][c]:
+                b2 = blk[dtrans[i][c] - 1]
+                if b2 not in seen: seen.add(b2); q.append(b2); order.append(b2)
+    nxt = 2 * nst + 1
+    trie = [b for b in order if is_trie(rep[b])]
+    for b in order:
+        if b not in num and b not in trie: num[b] = nxt; nxt += 1
+    S_dead = nxt; S_eob = nxt + 1; S_dflt = nxt + 2; nxt += 3
+    # trie states in reverse rule order, walking the strings
+    for r in reversed(range(len(rules))):
+        rule = rules[r]
+        if rule['const'] is None: continue
+        for s in starts:
+            b = blk[s]; i = rep[b]
+            for ch in rule['const']:
+                if not dtrans[i][ch]: break
+                b = blk[dtrans[i][ch] - 1]; i = rep[b]
+                if b not in num and b in trie: num[b] = nxt; nxt += 1
+    for b in trie:
+        if b not in num: num[b] = nxt; nxt += 1
+    N = nxt - 1
+    delta = [[0] * 256 for _ in range(N + 1)]; eobt = [0] * (N + 1); sact = [None] * (N + 1)
+    for b, s in num.items():
+        i = rep[b]
+        for c in range(256):
+            if dtrans[i][c]: delta[s][c] = num[blk[dtrans[i][c] - 1]]
+        sact[s] = act[i]
+    for s in range(1, N + 1):
+        if s in (S_dead, S_eob, S_dflt): continue
+        if any(delta[s]):
+            eobt[s] = delta[s][EOB]
+            delta[s][EOB] = S_eob
+    delta[S_dead][EOB] = S_eob
+    # BOL twins keep identical rows when there are no '<' rules
+    has_bol = any(r['bol'] for r in rules)
+    return dict(rules=rules, N=N, delta=delta, eobt=eobt, act=sact, dead=S_dead,
+                eob=S_eob, dflt=S_dflt, nst=nst, has_bol=has_bol)
+
+def pack(g):
+    N, delta = g['N'], g['delta']
+    dom = [frozenset(c for c in range(256) if delta[s][c]) for s in range(N + 1)]
+    default = [0] * (N + 1); entries = {}
+    for s in range(1, N + 1):
+        best, bestn = 0, -1
+        for d in range(1, N + 1):
+            if d == s or not dom[d] or not dom[d] <= dom[s]: continue
+            if (len(dom[d]), d) >= (len(dom[s]), s): continue
+            agree = sum(1 for c in dom[d] if delta[d][c] == delta[s][c])
+            # the default chain of d must agree too: resolve effective row of d
+            if agree > bestn: best, bestn = d, agree
+        default[s] = best
+    # effective rows via chains; explicit entries where s differs from chain lookup
+    order = sorted(range(1, N + 1), key=lambda s: (len(dom[s]), s))
+    def lookup(s, c):
+        while s:
+            if c in entries[s]: return entries[s][c]
+            s = default[s]
+        return 0
+    for s in order:
+        d = default[s]
+        e = {}
+        for c in dom[s]:
+            if not d or lookup(d, c) != delta[s][c]: e[c] = delta[s][c]
+        # chars where s has no transition must resolve to 0 through the chain
+        for c in range(256):
+            if c not in dom[s] and d and lookup(d, c): raise RuntimeError('default leak')
+        entries[s] = e
+    comb = {}; base = [0] * (N + 1)
+    for s in range(1, N + 1):
+        e = entries[s]
+        if not e: continue
+        b = 0
+        while any((b + c) in comb for c in e): b += 1
+        for c, t in e.items(): comb[b + c] = (s, t)
+        base[s] = b
+    size = max(base) + 255
+    # verify
+    for s in range(1, N + 1):
+        for c in range(256):
+            x = s; r = 0
+            while x:
+                v = comb.get(base[x] + c)
+                if v and v[0] == x: r = v[1]; break
+                x = default[x]
+            assert r == delta[s][c], (s, c, r, delta[s][c])
+    return dict(comb=comb, base=base, default=default, size=size)
+
+# ---------------------------------------------------------------- emit
+def rows(items, per, fmt):
+    out = ''
+    for k in range(0, len(items), per):
+        out += ''.join(fmt % x for x in items[k:k+per]) + '\n'
+    return out
+
+def emit(sp, g, pk, frame_c, frame_h, cname, hname, last_accept):
+    name = sp.name
+    f = frame_c.replace('l_scan', name)
+    # defines
+    defs = '# define yyDStateCount\t%d\n# define yyTableSize\t%d\n# define yyEobState\t%d\n# define yyDefaultState\t%d\n# define yyToClassArraySize\t0\n' % (g['N'], pk['size'], g['eob'], g['dflt'])
+    for k, st in enumerate(sp.starts): defs += '# define %s\t%d\n' % (st, 2 * k + 1)
+    if last_accept: defs += '# define yyLastAccept\n'
+    code = ' '.join(v[1] for v in sp.sections.values()) + ' '.join(r['action'] for r in sp.rules)
+    for flag, pat in (('GetWord', r'\b%s_GetWord\b' % name), ('GetLower', r'\b%s_GetLower\b' % name),
+                      ('GetUpper', r'\b%s_GetUpper\b' % name), ('input', r'\binput\b'),
+                      ('unput', r'\bunput\b'), ('yyless', r'\byyless\b'), ('yyLess', r'\byyLess\b'),
+                      ('yyPush', r'\byyPush\b'), ('yyPop', r'\byyPop\b')):
+        if re.search(pat, code) and ('# ifdef xx%s' % flag in f or 'defined xx%s' % flag in f):
+            defs += '# define xx%s\n' % flag
+    f = f.replace('@DEFINES@\n', defs)
+    comb = [pk['comb'].get(i, (0, 0)) for i in range(pk['size'] + 1)]
+    f = f.replace('@COMB@\n', rows(comb, 5, '{%4d, %4d}, '))
+    f = f.replace('@BASE@\n', rows(pk['base'][1:], 4, '& yyComb [%4d], '))
+    f = f.replace('@DEFTAB@\n', rows(pk['default'][1:], 10, '%5d, '))
+    f = f.replace('@EOBTRANS@\n', rows(g['eobt'][1:], 10, '%5d, '))
+    if last_accept:
+        final = [int(g['act'][s] is not None or s == g['eob']) for s in range(1, g['N'] + 1)]
+        f = f.replace('@FINAL@\n', 'static\trbool\t\tyyFinal\t\t[yyDStateCount + 1] = { 0,\n%s};\n'
+                      % rows(final, 20, '%d, '))
+    else:
+        f = f.replace('@FINAL@\n', '')
+    if 'GLOBAL' in sp.sections:
+        ln, inner = sp.sections['GLOBAL']
+        f = f.replace('@GLOBAL@\n', '/* line %d "%s" */\n%s\n@CLINE@\n' % (ln, sp.path, inner))
+    else:
+        f = f.replace('@GLOBAL@\n', ERRATTR.replace('l_scan', name))
+    if 'LOCAL' in sp.sections:
+        ln, inner = sp.sections['LOCAL']
+        f = f.replace('@LOCAL@\n', '/* line %d "%s" */\n%s\n@CLINE@\n' % (ln, sp.path, inner))
+    else:
+        f = f.replace('@LOCAL@\n', '')
+    bol = '   if (yyChBufferIndexReg [-1] == yyEolCh) yyState ++;\n' if g['has_bol'] else ''
+    bol2 = '  \t    if (yyChBufferIndexReg [-1] == yyEolCh) yyState ++;\n' if g['has_bol'] else ''
+    f = f.replace('@BOL@\n', bol).replace('@BOL2@\n', bol2)
+    # actions
+    a = ''
+    fin = {}
+    for s in range(1, g['N'] + 1):
+        if g['act'][s] is not None: fin.setdefault(g['act'][s], []).append(s)
+    nrules = len(sp.rules)
+    for r, rule in enumerate(g['rules'][:nrules]):
+        if r not in fin:
+            sys.stderr.write('warning: rule at line %d is never matched\n' % rule['line']); continue
+        a += ''.join('case %d:;\n' % s for s in fin[r])
+        a += 'yySetPosition\n/* line %d "%s" */\n{%s\n@CLINE@\n} goto yyBegin;\n' % (rule['line'], sp.path, rule['action'])
+    restart = ('yyLastState = yyDefaultState;\nyyLastIndex = yyChBufferIndexReg;\n' if last_accept
+               else 'yyStatePtr = & yyStateStack [1];\n')
+    builtin = {'blank': '{/* BlankAction */\nwhile (* yyChBufferIndexReg ++ == \' \') ;\n%s_TokenPtr = (yytChar *) -- yyChBufferIndexReg;\nyyState = yyStartState;\n%sgoto yyContinue;\n' % (name, restart),
+               'tab': '{/* TabAction */\nyyTab;\n', 'eol': '{/* EolAction */\nyyEol (0);\n'}
+    for r in range(nrules, nrules + 3):
+        if r not in fin: continue
+        a += ''.join('case %d:;\n' % s for s in fin[r])
+        a += builtin[g['rules'][r]['builtin']] + '@CLINE@\n} goto yyBegin;\n'
+    if not last_accept:		# only popped from the stack
+        a += ''.join('case %d:;\n' % s for s in range(1, g['N'] + 1)
+                     if g['act'][s] is None and s not in (g['eob'], g['dflt']))
+    f = f.replace('@ACTIONS@\n', a)
+    f = f.replace('@DFLT@', str(g['dflt'])).replace('@EOB@', str(g['eob']))
+    for sec in ('DEFAULT', 'EOF'):
+        if sec in sp.sections:
+            ln, inner = sp.sections[sec]
+            f = f.replace('@%s@\n' % sec, '/* line %d "%s" */\n%s\n@CLINE@\n' % (ln, sp.path, inner))
+        else:
+            f = f.replace('@%s@\n' % sec, '')
+    for sec in ('BEGIN', 'CLOSE'):
+        if sec in sp.sections:
+            ln, inner = sp.sections[sec]
+            f = f.replace('@%s@\n' % sec, '/* line %d "%s" */\n%s\n@CLINE@\n' % (ln, sp.path, inner))
+        else:
+            f = f.replace('@%s@\n' % sec, '')
+    out = []
+    for k, line in enumerate(f.split('\n')):
+        if line == '@CLINE@': line = '/* line %d "%s" */' % (k + 2, cname)
+        out.append(line)
+    c = '\n'.join(out)
+    h = frame_h.replace('l_scan', name)
+    if 'EXPORT' in sp.sections:
+        ln, inner = sp.sections['EXPORT']
+        h = h.replace('@EXPORT@\n', '/* line %d "%s" */\n%s\n@HLINE@\n' % (ln, sp.path, inner))
+    else:
+        h = h.replace('@EXPORT@\n', '')
+    out = []
+    for k, line in enumerate(h.split('\n')):
+        if line == '@HLINE@': line = "/* line %d \"%s\" */" % (k + 1, hname)
+        out.append(line)
+    return c, '\n'.join(out)
+
+ERRATTR = '''void l_scan_ErrorAttribute
+# ifdef HAVE_ARGS
+   (int Token, l_scan_tScanAttribute * Attribute)
+# else
+   (Token, Attribute)
+   int Token;
+   l_scan_tScanAttribute * Attribute;
+# endif
+   { }
+'''
+
+if __name__ == '__main__':
+    args = sys.argv[1:]
+    last_accept = args[:1] == ['-a']
+    if last_accept: args = args[1:]
+    if len(args) not in (1, 2):
+        sys.exit('usage: minirex.py [-a] spec.rex [directory]')
+    spec = args[0]
+    outdir = args[1] if len(args) == 2 else '.'
+    here = os.path.dirname(os.path.abspath(__file__))
+    sp = parse_spec(spec)
+    g = generate(sp); pk = pack(g)
+    fc = open(os.path.join(here, 'frame.c')).read(); fh = open(os.path.join(here, 'frame.h')).read()
+    c, h = emit(sp, g, pk, fc, fh, sp.name + '.c', sp.name + '.h', last_accept)
+    open(os.path.join(outdir, sp.name + '.c'), 'w').write(c)
+    open(os.path.join(outdir, sp.name + '.h'), 'w').write(h)
+    print('%s: %d states, table size %d' % (sp.name, g['N'], pk['size']))
@@ -0,0 +1,134 @@
+/* Project:  COCKTAIL training
+ * Descr:    a simple scanner generated with rex
+ * Kind:     resynchronization index for random access scanning
+ *
+ * The index file consists of a header and entries of fixed size, sorted by
+ * offset and hence by line, so that an entry is found by binary search.
+ * The header identifies the source by its size and time of modification,
+ * an index of another version of it is not used.
+ */
+
+# include <stdio.h>
+# include <stdint.h>
+# include <string.h>
+# include <sys/types.h>
+# include <sys/stat.h>
+# include "Position.h"
+# include "l_scan.h"
+# include "include.h"
+# include "resync.h"
+
+# define RESYNC_MAGIC	"lscidx02"
+
+typedef struct {
+  char		Magic [8];
+  int64_t	Interval;
+  int64_t	Size;			/* of the source */
+  int64_t	MTime;			/* of the source */
+} tHeader;
+
+typedef struct {
+  int64_t		Offset;		/* of the next character */
+  uint32_t		Line;		/* of the next character */
+  uint32_t		Reserved;
+  l_scan_tCheckpoint	Checkpoint;
+} tEntry;
+
+static FILE *		index_file = NULL;
+static long		interval;
+static l_scan_tOffset	next_entry;
+
+/* Enters the size and the time of modification of the source `FileName'
+ * (standard input, if NULL) into `*Header'
+ */
+static int StatSource (char * FileName, tHeader * Header)
+{
+  struct stat st;
+  if ((FileName == NULL ? fstat (fileno (stdin), & st) : stat (FileName, & st)) < 0)
+    return 0;
+  Header->Size  = (int64_t) st.st_size;
+  Header->MTime = (int64_t) st.st_mtime;
+  return 1;
+}
+
+int BeginResyncIndex (char * FileName, char * IndexName, long Interval)
+{
+  tHeader header;
+  memset (& header, 0, sizeof (header));
+  if (! StatSource (FileName, & header)) return 0;
+  index_file = fopen (IndexName, "wb");
+  if (index_file == NULL) return 0;
+  memcpy (header.Magic, RESYNC_MAGIC, sizeof (header.Magic));
+  header.Interval = Interval;
+  fwrite (& header, sizeof (header), 1, index_file);
+  interval   = Interval;
+  next_entry = Interval;
+  return 1;
+}
+
+void ResyncPoint (void)
+{
+  tEntry entry;
+  if (index_file == NULL || l_scan_TokenOffset < next_entry) return;
+  memset (& entry, 0, sizeof (entry));
+  if (! l_scan_Checkpoint (& entry.Checkpoint)) return;	/* in an include file */
+  entry.Offset = l_scan_CheckpointOffset (& entry.Checkpoint);
+  entry.Line   = l_scan_CheckpointLine (& entry.Checkpoint);
+  fwrite (& entry, sizeof (entry), 1, index_file);
+  next_entry = entry.Offset + interval;
+}
+
+void EndResyncIndex (void)
+{
+  if (index_file == NULL) return;
+  fclose (index_file);
+  index_file = NULL;
+}
+
+static int ReadEntry (FILE * f, off_t i, tEntry * entry)
+{
+  return fseeko (f, (off_t) sizeof (tHeader) + i * (off_t) sizeof (tEntry), SEEK_SET) == 0
+      && fread (entry, sizeof (tEntry), 1, f) == 1;
+}
+
+int BeginRange (char * FileName, char * IndexName, unsigned long Line)
+{
+  FILE *   f = fopen (IndexName, "rb");
+  tHeader  header, source;
+  tEntry   entry;
+  off_t    low = 0, high, found = -1;
+  char *   text;
+  size_t   length;
+
+  if (f == NULL) return 0;
+  if (fread (& header, sizeof (header), 1, f) != 1 ||
+      memcmp (header.Magic, RESYNC_MAGIC, sizeof (header.Magic)) != 0 ||
+      ! StatSource (FileName, & source) ||
+      header.Size != source.Size || header.MTime != source.MTime ||
+      fseeko (f, 0, SEEK_END) != 0) {
+    fclose (f);
+    return 0;
+  }
+  high = (ftello (f) - (off_t) sizeof (tHeader)) / (off_t) sizeof (tEntry) - 1;
+
+  /* the last entry at or before `Line' */
+  while (low <= high) {
+    off_t mid = low + (high - low) / 2;
+    if (! ReadEntry (f, mid, & entry)) { fclose (f); return 0; }
+    if (entry.Line <= Line) { found = mid; low = mid + 1; }
+    else high = mid - 1;
+  }
+  if (found >= 0 && ! ReadEntry (f, found, & entry)) { fclose (f); return 0; }
+  fclose (f);
+
+  if (MapInclude (FileName, & text, & length)) {
+    if (found < 0) l_scan_BeginMemoryL (text, length);
+    else l_scan_RestoreMemory (& entry.Checkpoint, text, length);
+    return 1;
+  }
+  if (found < 0) {
+    l_scan_BeginFile (FileName);
+    return 1;
+  }
+  return l_scan_RestoreFile (& entry.Checkpoint, FileName);
+}
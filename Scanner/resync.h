@@ -0,0 +1,37 @@
+/* Project:  COCKTAIL training
+ * Descr:    a simple scanner generated with rex
+ * Kind:     resynchronization index for random access scanning (interface)
+ */
+
+# ifndef resync_H
+# define resync_H
+
+# define DEFAULT_RESYNC_INTERVAL	(64L * 1024)
+
+extern int BeginResyncIndex (char * FileName, char * IndexName, long Interval);
+/* Creates the index file `IndexName' for the input which is about to be
+ * scanned, the file `FileName' (standard input, if NULL). While scanning,
+ * ResyncPoint has to be called after every token; about every `Interval'
+ * bytes it records the offset, the line and a checkpoint of the scanner
+ * (see l_scan_Checkpoint). The index records the size and the time of
+ * modification of the file.
+ * Returns 0, if the file can not be created, 1 otherwise.
+ */
+
+extern void ResyncPoint (void);
+/* Records an entry, if `Interval' bytes have passed since the last one */
+
+extern void EndResyncIndex (void);
+/* Completes and closes the index file */
+
+extern int BeginRange (char * FileName, char * IndexName, unsigned long Line);
+/* Restarts the scanner for the file `FileName' at the last entry of its
+ * index `IndexName' at or in front of line `Line', so that the following calls
+ * of l_scan_GetToken return the tokens from there on. The file is mapped
+ * into memory (see MapInclude), if possible.
+ * Returns 0, if the index can not be read or does not match, i.e. the size
+ * or the time of modification of the file has changed since the index was
+ * written, 1 otherwise.
+ */
+
+# endif
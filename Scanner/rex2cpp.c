@@ -0,0 +1,516 @@
+/* Project:  COCKTAIL training
+ * Descr:    a simple scanner generated with rex
+ * Kind:     C++ backend: emits the DFA of a rex scanner as constexpr tables
+ *
+ * usage: rex2cpp [-i] [-p profile] l_scan.c l_scan.h > l_scan_tables.hpp
+ *
+ * The tables (yyComb, yyBasePtr, yyDefault, yyEobTrans), the start states
+ * and the mapping from final states to rules are read from the C scanner
+ * generated by rex, the token codes from its header. The result is used by
+ * the header-only scanner template in l_scan.hpp.
+ * A rule is named by a comment "rule <id>" in its action, the rule numbers
+ * are emitted as rule_<id>, so the C++ actions do not depend on the order
+ * or the lines of the rules.
+ *
+ * Characters with the same transitions in all states are merged into one
+ * class, the scanner maps each input character to its class before the
+ * lookup. With -i every state gets the transitions of both cases of each
+ * letter, i.e. the whole scanner becomes case insensitive and both cases
+ * fall into one class. A transition on one case only is extended to the
+ * other one (the "E" of floats in l.rex accepts "e" then); rex2cpp refuses
+ * -i if a state has different transitions for the two cases.
+ *
+ * With -p the states are renumbered by the visit counts in `profile' (as
+ * written by l_scan::state_profile, recorded with tables generated without
+ * -p) and the transitions are packed again, hottest states first, so that
+ * the rows of the frequently visited states share few cache lines.
+ */
+
+# include <stdio.h>
+# include <stdlib.h>
+# include <string.h>
+# include <ctype.h>
+
+# define MAX_STATES	4096
+# define MAX_TABLE	65536
+# define MAX_RULES	1024
+# define MAX_NAMES	256
+
+/* actions of final states, besides the user rules 1, 2, ... */
+# define ACTION_NONE	0		/* non final state */
+# define ACTION_BLANK	(-1)
+# define ACTION_TAB	(-2)
+# define ACTION_EOL	(-3)
+
+typedef struct { int check, next; } tComb;
+
+static tComb comb      [MAX_TABLE];
+static int   table_size;
+static int   base      [MAX_STATES];		/* index into comb */
+static int   dflt      [MAX_STATES];
+static int   eob_trans [MAX_STATES];
+static int   action    [MAX_STATES];
+static int   state_count, eob_state, default_state;
+
+static int   rule_count;
+static int   rule_line  [MAX_RULES];
+static char  rule_token [MAX_RULES] [64];	/* "" : no token returned */
+static char  rule_id    [MAX_RULES] [64];	/* "" : no id */
+
+static int   start_count;
+static char  start_name  [MAX_NAMES] [64];
+static int   start_value [MAX_NAMES];
+
+static int   token_count;
+static char  token_name  [MAX_NAMES] [64];
+static int   token_value [MAX_NAMES];
+
+static unsigned long visits [MAX_STATES];	/* from the profile */
+
+/*****************************************************************************
+ * helpers
+ *****************************************************************************/
+
+static char * ReadFile (const char * name)
+{
+  FILE * f = fopen (name, "rb");
+  long   size;
+  char * text;
+  if (f == NULL) { perror (name); exit (1); }
+  fseek (f, 0, SEEK_END);
+  size = ftell (f);
+  fseek (f, 0, SEEK_SET);
+  text = malloc (size + 1);
+  if (text == NULL || fread (text, 1, size, f) != (size_t) size) {
+    fprintf (stderr, "rex2cpp: cannot read %s\n", name);
+    exit (1);
+  }
+  text [size] = '\0';
+  fclose (f);
+  return text;
+}
+
+static void Fail (const char * what)
+{
+  fprintf (stderr, "rex2cpp: %s not found, is this a scanner generated by rex?\n",
+	   what);
+  exit (1);
+}
+
+/* Returns the position after the "= {" of the initializer of `array' */
+static char * FindTable (char * text, const char * array)
+{
+  char * p = text;
+  while ((p = strstr (p, array)) != NULL) {
+    char * eol = strchr (p, '\n');
+    char * init = strstr (p, "= {");
+    if (init != NULL && (eol == NULL || init < eol)) return init + 3;
+    p += strlen (array);
+  }
+  Fail (array);
+  return NULL;
+}
+
+/* Reads the numbers of an initializer up to "};", skipping everything else */
+static int ReadNumbers (char * p, int * numbers, int max)
+{
+  int n = 0;
+  while (*p && ! (p [0] == '}' && p [1] == ';')) {
+    if (isdigit ((unsigned char) *p)) {
+      if (n == max) Fail ("room for table");
+      numbers [n ++] = (int) strtol (p, & p, 10);
+    } else {
+      p ++;
+    }
+  }
+  return n;
+}
+
+static int Define (char * text, const char * name)
+{
+  char pattern [80];
+  char * p;
+  sprintf (pattern, "# define %s\t", name);
+  if ((p = strstr (text, pattern)) == NULL) Fail (name);
+  return atoi (p + strlen (pattern));
+}
+
+/*****************************************************************************
+ * reading the generated scanner
+ *****************************************************************************/
+
+static void ReadTables (char * text)
+{
+  static int numbers [2 * MAX_TABLE];
+  int i, n;
+
+  state_count   = Define (text, "yyDStateCount");
+  eob_state     = Define (text, "yyEobState");
+  default_state = Define (text, "yyDefaultState");
+  if (state_count >= MAX_STATES) Fail ("room for states");
+  if (Define (text, "yyToClassArraySize") != 0)
+    Fail ("scanner without character classes");
+
+  n = ReadNumbers (FindTable (text, "yyComb"), numbers, 2 * MAX_TABLE);
+  table_size = n / 2;
+  for (i = 0; i < table_size; i ++) {
+    comb [i].check = numbers [2 * i];
+    comb [i].next  = numbers [2 * i + 1];
+  }
+  /* yyBasePtr: 0, & yyComb [n], ... */
+  n = ReadNumbers (FindTable (text, "yyBasePtr"), base, MAX_STATES);
+  if (n != state_count + 1) Fail ("yyBasePtr");
+  n = ReadNumbers (FindTable (text, "yyDefault"), dflt, MAX_STATES);
+  if (n != state_count + 1) Fail ("yyDefault");
+  n = ReadNumbers (FindTable (text, "yyEobTrans"), eob_trans, MAX_STATES);
+  if (n != state_count + 1) Fail ("yyEobTrans");
+}
+
+/* The start states are defined right after yyToClassArraySize */
+static void ReadStartStates (char * text)
+{
+  char * p = strstr (text, "# define yyToClassArraySize");
+  char name [64];
+  int value;
+  if (p == NULL) Fail ("yyToClassArraySize");
+  p = strchr (p, '\n') + 1;
+  while (sscanf (p, "# define %63s %d", name, & value) == 2) {
+    strcpy (start_name [start_count], name);
+    start_value [start_count ++] = value;
+    p = strchr (p, '\n') + 1;
+  }
+}
+
+/* The switch over the final states in GetToken lists groups of
+ *    case <state>:;
+ * followed by the action: a user rule starts with a line directive for the
+ * rex specification, the builtin actions are marked by comments.
+ */
+static void ReadActions (char * text)
+{
+  char * p = strstr (text, "switch (* -- yyStatePtr) {");
+  int pending [MAX_STATES];
+  int pending_count = 0, i;
+
+  if (p == NULL) Fail ("switch over final states");
+  for (;;) {
+    int state, kind, length = 0;
+    char * eol;
+    p = strchr (p, '\n');
+    if (p == NULL) break;
+    p ++;
+    if (sscanf (p, "case %d:;%n", & state, & length) == 1 && length > 0) {
+      pending [pending_count ++] = state;
+      continue;
+    }
+    if (pending_count == 0) {
+      if (strncmp (p, "case ", 5) == 0) break;	/* default and eob state */
+      continue;
+    }
+    eol = strchr (p, '\n');
+    if (strncmp (p, "/* line ", 8) == 0) {
+      char * end = strstr (p, "} goto yyBegin;");
+      char * ret = strstr (p, "return tok_");
+      char * id  = strstr (p, "/* rule ");
+      if (++ rule_count >= MAX_RULES) Fail ("room for rules");
+      rule_line [rule_count] = atoi (p + 8);
+      if (ret != NULL && (end == NULL || ret < end))
+	sscanf (ret + 11, "%63[A-Za-z0-9_]", rule_token [rule_count]);
+      if (id != NULL && (end == NULL || id < end)) {
+	sscanf (id + 8, "%63[A-Za-z0-9_]", rule_id [rule_count]);
+	for (i = 1; i < rule_count; i ++)
+	  if (strcmp (rule_id [i], rule_id [rule_count]) == 0) {
+	    fprintf (stderr, "rex2cpp: rule id %s is used twice\n", rule_id [i]);
+	    exit (1);
+	  }
+      }
+      kind = rule_count;
+    } else if (strstr (p, "BlankAction") != NULL && strstr (p, "BlankAction") < eol) {
+      kind = ACTION_BLANK;
+    } else if (strstr (p, "TabAction") != NULL && strstr (p, "TabAction") < eol) {
+      kind = ACTION_TAB;
+    } else if (strstr (p, "EolAction") != NULL && strstr (p, "EolAction") < eol) {
+      kind = ACTION_EOL;
+    } else if (strstr (p, "non final states") != NULL && strstr (p, "non final states") < eol) {
+      kind = ACTION_NONE;
+    } else {
+      continue;					/* yySetPosition etc. */
+    }
+    for (i = 0; i < pending_count; i ++) action [pending [i]] = kind;
+    pending_count = 0;
+  }
+}
+
+/* The token codes are defined as  # define tok_<name> <value>  */
+static void ReadTokens (char * text)
+{
+  char * p = text;
+  while ((p = strstr (p, "# define tok_")) != NULL) {
+    char name [64];
+    int value;
+    if (sscanf (p, "# define tok_%63[A-Za-z0-9_] %d", name, & value) == 2) {
+      strcpy (token_name [token_count], name);
+      token_value [token_count ++] = value;
+    }
+    p += 13;
+  }
+}
+
+/*****************************************************************************
+ * character classes, profile guided renumbering and packing
+ *****************************************************************************/
+
+/* The transitions of the states, unpacked: row [s] [c] is the next state
+ * on character c, 0 if the default state of s has to be asked.
+ */
+static unsigned short row [MAX_STATES] [256];
+
+static int char_class [256];
+static int class_count;
+static int fold_case;				/* -i */
+
+static void Unpack (void)
+{
+  int s, c;
+  for (s = 1; s <= state_count; s ++)
+    for (c = 0; c <= 255; c ++)
+      if (base [s] + c < table_size && comb [base [s] + c].check == s)
+	row [s] [c] = comb [base [s] + c].next;
+}
+
+static int SameColumn (int c1, int c2)
+{
+  int s;
+  for (s = 1; s <= state_count; s ++)
+    if (row [s] [c1] != row [s] [c2]) return 0;
+  return 1;
+}
+
+/* Characters with identical columns share a class */
+static void MakeClasses (void)
+{
+  static int representative [256];
+  int c, k;
+
+  for (c = 0; c <= 255; c ++) {
+    for (k = 0; k < class_count; k ++)
+      if (SameColumn (representative [k], c)) break;
+    if (k == class_count) representative [class_count ++] = c;
+    char_class [c] = k;
+  }
+}
+
+/* Returns the transition of state `s' on `c', following the default chain */
+static int Next (int s, int c)
+{
+  for (; s != 0; s = dflt [s])
+    if (row [s] [c] != 0) return row [s] [c];
+  return 0;
+}
+
+/* -i: both cases of a letter get the transition of either case explicitly,
+ * as a state may inherit the transition on one case from its default state.
+ */
+static void FoldCase (void)
+{
+  static unsigned short folded [MAX_STATES] [26];
+  int s, c, conflicts = 0;
+
+  for (s = 1; s <= state_count; s ++)
+    for (c = 'a'; c <= 'z'; c ++) {
+      int lower = Next (s, c), upper = Next (s, toupper (c));
+      if (lower != 0 && upper != 0 && lower != upper) {
+	fprintf (stderr, "rex2cpp: -i: state %d distinguishes `%c' and `%c'\n",
+		 s, toupper (c), c);
+	conflicts ++;
+      }
+      folded [s] [c - 'a'] = lower != 0 ? lower : upper;
+    }
+  if (conflicts > 0) exit (1);
+  for (s = 1; s <= state_count; s ++)
+    for (c = 'a'; c <= 'z'; c ++)
+      if (folded [s] [c - 'a'] != 0)
+	row [s] [c] = row [s] [toupper (c)] = folded [s] [c - 'a'];
+}
+
+static void ReadProfile (const char * name)
+{
+  FILE * f = fopen (name, "r");
+  int state;
+  unsigned long count;
+  if (f == NULL) { perror (name); exit (1); }
+  while (fscanf (f, "%d %lu", & state, & count) == 2) {
+    if (state <= 0 || state > state_count) {
+      fprintf (stderr, "rex2cpp: %s does not fit the tables, state %d\n", name, state);
+      exit (1);
+    }
+    visits [state] += count;
+  }
+  fclose (f);
+}
+
+static int Hotter (const void * a, const void * b)
+{
+  int s1 = * (const int *) a, s2 = * (const int *) b;
+  if (visits [s1] != visits [s2]) return visits [s1] < visits [s2] ? 1 : -1;
+  return s1 - s2;				/* keep the order of rex */
+}
+
+/* Renumbers the states by descending visit count (all counts are 0 without
+ * a profile) and packs the class rows first fit in this order.
+ */
+static void Pack (void)
+{
+  static int order [MAX_STATES], new_of [MAX_STATES], tmp [MAX_STATES];
+  static int representative [256];
+  int i, s, c, k, size = 0;
+
+  for (c = 255; c >= 0; c --) representative [char_class [c]] = c;
+  for (s = 1; s <= state_count; s ++) order [s - 1] = s;
+  qsort (order, state_count, sizeof (int), Hotter);
+  new_of [0] = 0;
+  for (i = 0; i < state_count; i ++) new_of [order [i]] = i + 1;
+
+  memset (comb, 0, sizeof (comb));
+  for (i = 0; i < state_count; i ++) {
+    unsigned short * r = row [order [i]];
+    int b;
+    for (b = 0; ; b ++) {			/* first fit */
+      if (b + class_count > MAX_TABLE) Fail ("room for table");
+      for (k = 0; k < class_count; k ++)
+	if (r [representative [k]] != 0 && comb [b + k].check != 0) break;
+      if (k == class_count) break;
+    }
+    for (k = 0; k < class_count; k ++)
+      if (r [representative [k]] != 0) {
+	comb [b + k].check = i + 1;
+	comb [b + k].next  = new_of [r [representative [k]]];
+      }
+    base [i + 1] = b;
+    if (b + class_count > size) size = b + class_count;	/* room for every class */
+  }
+  table_size = size;
+
+# define PERMUTE(array) \
+  for (s = 1; s <= state_count; s ++) tmp [new_of [s]] = array [s]; \
+  for (s = 1; s <= state_count; s ++) array [s] = tmp [s];
+  PERMUTE (dflt)
+  PERMUTE (eob_trans)
+  PERMUTE (action)
+  for (s = 1; s <= state_count; s ++) {
+    dflt [s]      = new_of [dflt [s]];
+    eob_trans [s] = new_of [eob_trans [s]];
+  }
+  for (i = 0; i < start_count; i ++) start_value [i] = new_of [start_value [i]];
+  eob_state     = new_of [eob_state];
+  default_state = new_of [default_state];
+}
+
+/*****************************************************************************
+ * emitting the C++ tables
+ *****************************************************************************/
+
+static void EmitArray (const char * type, const char * name, int * values, int n)
+{
+  int i;
+  printf ("  static constexpr %s %s [%d] = {", type, name, n);
+  for (i = 0; i < n; i ++)
+    printf ("%s%5d,", i % 10 == 0 ? "\n   " : "", values [i]);
+  printf ("\n  };\n");
+}
+
+static void Emit (const char * source)
+{
+  int i;
+
+  printf ("// Generated by rex2cpp from %s, do not edit.\n\n", source);
+  printf ("# ifndef l_scan_tables_HPP\n# define l_scan_tables_HPP\n\n");
+  printf ("namespace l_scan {\n\n");
+
+  printf ("enum token_kind : int {\n  eof = 0,\n");
+  for (i = 0; i < token_count; i ++)
+    printf ("  %s = %d,\n", token_name [i], token_value [i]);
+  printf ("};\n\n");
+
+  printf ("enum start_state : int {\n");
+  for (i = 0; i < start_count; i ++)
+    printf ("  %s = %d,\n", start_name [i], start_value [i]);
+  printf ("};\n\n");
+
+  printf ("enum rule_id : int {\n  rule_default = 0,\t// no rule matches\n");
+  for (i = 1; i <= rule_count; i ++)
+    if (rule_id [i] [0]) printf ("  rule_%s = %d,\n", rule_id [i], i);
+  printf ("};\n\n");
+
+  printf ("struct tables {\n");
+  printf ("  static constexpr int state_count   = %d;\n", state_count);
+  printf ("  static constexpr int table_size    = %d;\n", table_size);
+  printf ("  static constexpr int eob_state     = %d;\n", eob_state);
+  printf ("  static constexpr int default_state = %d;\n", default_state);
+  printf ("  static constexpr int rule_count    = %d;\n", rule_count);
+  printf ("  static constexpr int max_character = 255;\n");
+  printf ("  static constexpr int eob_character = 0177;\n\n");
+  printf ("  // actions of the final states: rule number, or\n");
+  printf ("  static constexpr int action_none  =  %d;\n", ACTION_NONE);
+  printf ("  static constexpr int action_blank = %d;\n", ACTION_BLANK);
+  printf ("  static constexpr int action_tab   = %d;\n", ACTION_TAB);
+  printf ("  static constexpr int action_eol   = %d;\n\n", ACTION_EOL);
+
+  printf ("  static constexpr bool fold_case     = %s;\n", fold_case ? "true" : "false");
+  printf ("  static constexpr int  class_count   = %d;\n", class_count);
+  EmitArray ("unsigned char", "char_class", char_class, 256);
+
+  /* check and next side by side: one cache line per transition */
+  printf ("  struct comb_entry { unsigned short check, next; };\n");
+  printf ("  static constexpr comb_entry comb [%d] = {", table_size);
+  for (i = 0; i < table_size; i ++)
+    printf ("%s{%3d,%3d},", i % 6 == 0 ? "\n   " : "", comb [i].check, comb [i].next);
+  printf ("\n  };\n");
+  EmitArray ("int", "base", base, state_count + 1);
+  EmitArray ("unsigned short", "default_state_of", dflt, state_count + 1);
+  EmitArray ("unsigned short", "eob_trans", eob_trans, state_count + 1);
+  EmitArray ("signed char", "action", action, state_count + 1);
+
+  printf ("\n  // token returned by the action of a rule, if it just returns one\n");
+  printf ("  static constexpr int rule_token [%d] = {\n    0,\n", rule_count + 1);
+  for (i = 1; i <= rule_count; i ++)
+    printf ("    %s,\t// %s%s%sline %d\n", rule_token [i] [0] ? rule_token [i] : "0",
+	    rule_id [i] [0] ? "rule_" : "", rule_id [i], rule_id [i] [0] ? ", " : "",
+	    rule_line [i]);
+  printf ("  };\n");
+  printf ("};\n\n} // namespace l_scan\n\n# endif\n");
+}
+
+int main (int argc, char * argv [])
+{
+  char * scanner, * header, * profile = NULL;
+  for (;;) {
+    if (argc >= 3 && strcmp (argv [1], "-i") == 0) {
+      fold_case = 1;
+      argc --; argv ++;
+    } else if (argc >= 4 && strcmp (argv [1], "-p") == 0) {
+      profile = argv [2];
+      argc -= 2; argv += 2;
+    } else {
+      break;
+    }
+  }
+  if (argc != 3) {
+    fprintf (stderr,
+	     "usage: rex2cpp [-i] [-p profile] <scanner>.c <scanner>.h > <scanner>_tables.hpp\n");
+    return 1;
+  }
+  scanner = ReadFile (argv [1]);
+  header  = ReadFile (argv [2]);
+  ReadTables (scanner);
+  ReadStartStates (scanner);
+  ReadActions (scanner);
+  ReadTokens (header);
+  Unpack ();
+  if (fold_case) FoldCase ();
+  MakeClasses ();
+  if (profile != NULL) ReadProfile (profile);
+  Pack ();
+  Emit (argv [1]);
+  return 0;
+}
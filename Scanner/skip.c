@@ -0,0 +1,120 @@
+/* Project:  COCKTAIL training
+ * Descr:    a simple scanner generated with rex
+ * Kind:     bulk skipping of comment and string bodies
+ */
+
+# include <string.h>
+# include "skip.h"
+
+# if defined __SSE2__
+#  include <emmintrin.h>
+# endif
+
+/* Bytes which have to be looked at inside a comment */
+static const unsigned char significant [256] = {
+  ['\t'] = 1, ['\n'] = 1, ['#'] = 1, ['('] = 1,
+};
+
+unsigned char * SkipNestedComment (unsigned char * Ptr, unsigned char * End,
+				   int * Nesting, unsigned int * LineCount,
+				   unsigned char ** LineStart, int TabSpace)
+{
+  unsigned int   lines = *LineCount;
+  unsigned char *start = *LineStart;
+
+  while (Ptr < End) {
+# if defined __SSE2__
+    /* fast path: find the next significant byte 16 bytes at a time */
+    if (End - Ptr >= 16) {
+      const __m128i tab   = _mm_set1_epi8 ('\t');
+      const __m128i nl    = _mm_set1_epi8 ('\n');
+      const __m128i hash  = _mm_set1_epi8 ('#');
+      const __m128i open  = _mm_set1_epi8 ('(');
+      __m128i block = _mm_loadu_si128 ((const __m128i *) Ptr);
+      unsigned int eol  = _mm_movemask_epi8 (_mm_cmpeq_epi8 (block, nl));
+      unsigned int stop = _mm_movemask_epi8 (_mm_or_si128 (
+			     _mm_or_si128 (_mm_cmpeq_epi8 (block, hash),
+					   _mm_cmpeq_epi8 (block, open)),
+			     _mm_cmpeq_epi8 (block, tab)));
+      if (stop == 0) {
+	/* only newlines (if any): count them all at once */
+	if (eol != 0) {
+	  lines += __builtin_popcount (eol);
+	  start  = Ptr + 31 - __builtin_clz (eol);
+	}
+	Ptr += 16;
+	continue;
+      } else {
+	unsigned int first = __builtin_ctz (stop);
+	eol &= (1u << first) - 1;		/* newlines in front of it */
+	if (eol != 0) {
+	  lines += __builtin_popcount (eol);
+	  start  = Ptr + 31 - __builtin_clz (eol);
+	}
+	Ptr += first;
+      }
+    }
+# endif
+    /* slow path: tail of the buffer and significant bytes */
+    if (! significant [*Ptr]) { Ptr ++; continue; }
+    switch (*Ptr) {
+    case '\n':
+      lines ++;
+      start = Ptr ++;
+      break;
+    case '\t':
+      start -= (TabSpace - 1 - (Ptr - start - 1)) & (TabSpace - 1);
+      Ptr ++;
+      break;
+    case '(':
+      if (Ptr + 1 == End) goto done;		/* partner still unknown */
+      if (Ptr [1] == '#') { ++ *Nesting; Ptr += 2; }
+      else Ptr ++;
+      break;
+    case '#':
+      if (Ptr + 1 == End) goto done;
+      if (Ptr [1] == ')') {
+	Ptr += 2;
+	if (-- *Nesting == 0) goto done;
+      } else {
+	Ptr ++;
+      }
+      break;
+    }
+  }
+done:
+  *LineCount = lines;
+  *LineStart = start;
+  return Ptr;
+}
+
+unsigned char * SkipToEol (unsigned char * Ptr, unsigned char * End)
+{
+  unsigned char * eol = memchr (Ptr, '\n', End - Ptr);
+  return eol != NULL ? eol : End;
+}
+
+unsigned char * ScanStringBody (unsigned char * Ptr, unsigned char * End)
+{
+# if defined __SSE2__
+  const __m128i quote     = _mm_set1_epi8 ('"');
+  const __m128i backslash = _mm_set1_epi8 ('\\');
+  const __m128i nl        = _mm_set1_epi8 ('\n');
+  const __m128i blank     = _mm_set1_epi8 (' ');
+  const __m128i tab       = _mm_set1_epi8 ('\t');
+  while (End - Ptr >= 16) {
+    __m128i block = _mm_loadu_si128 ((const __m128i *) Ptr);
+    unsigned int stop = _mm_movemask_epi8 (_mm_or_si128 (
+			   _mm_or_si128 (_mm_cmpeq_epi8 (block, quote),
+					 _mm_cmpeq_epi8 (block, backslash)),
+			   _mm_or_si128 (_mm_cmpeq_epi8 (block, nl),
+					 _mm_or_si128 (_mm_cmpeq_epi8 (block, blank),
+						       _mm_cmpeq_epi8 (block, tab)))));
+    if (stop != 0) return Ptr + __builtin_ctz (stop);
+    Ptr += 16;
+  }
+# endif
+  while (Ptr < End && *Ptr != '"' && *Ptr != '\\' && *Ptr != '\n' &&
+	 *Ptr != ' ' && *Ptr != '\t') Ptr ++;
+  return Ptr;
+}
@@ -0,0 +1,41 @@
+/* Project:  COCKTAIL training
+ * Descr:    a simple scanner generated with rex
+ * Kind:     bulk skipping of comment and string bodies (interface)
+ */
+
+# ifndef skip_H
+# define skip_H
+
+extern unsigned char * SkipNestedComment (unsigned char * Ptr,
+					  unsigned char * End,
+					  int * Nesting,
+					  unsigned int * LineCount,
+					  unsigned char ** LineStart,
+					  int TabSpace);
+/* Skips the body of a Modula-style (# ... #) comment, starting at `Ptr'.
+ * Only the bytes `(', `#', `\n' and `\t' are inspected one by one, all
+ * other bytes are passed over 16 at a time (if SSE2 is available).
+ * `*Nesting' is the current nesting depth, it is incremented by every "(#"
+ * and decremented by every "#)". Skipping stops right after the "#)" which
+ * brings `*Nesting' down to 0, or at `End', whatever comes first.
+ * A `(' or `#' immediately before `End' is not consumed, because its partner
+ * may only arrive with the next buffer fill.
+ * `*LineCount' and `*LineStart' are updated like the yyEol/yyTab macros of
+ * the generated scanner do it, i.e. `*LineStart' points to the last `\n'
+ * (moved back by tabs).
+ * Returns the position where skipping stopped.
+ */
+
+extern unsigned char * SkipToEol (unsigned char * Ptr, unsigned char * End);
+/* Skips the body of a comment up to end of line, starting at `Ptr'.
+ * Returns the position of the next `\n', which is not consumed, or `End'.
+ */
+
+extern unsigned char * ScanStringBody (unsigned char * Ptr, unsigned char * End);
+/* Scans the body of a string, starting at `Ptr'.
+ * Returns the position of the next `"', backslash, `\n', blank or tab, which
+ * is not consumed, or `End'. The bytes in front of it are plain string
+ * characters.
+ */
+
+# endif
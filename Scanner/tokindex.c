@@ -0,0 +1,408 @@
+/* Project:  COCKTAIL training
+ * Descr:    a simple scanner generated with rex
+ * Kind:     inverted index of identifiers and keywords
+ *
+ * Layout of the index file (all numbers in host byte order):
+ *    header	magic, number of files and terms, offsets of the sections
+ *    files	per file the offset and length of its name in the string pool
+ *    terms	per term (sorted by name) name, number of postings, number
+ *		of blocks and offset of its first block
+ *    strings	names of files and terms
+ *    postings	per block: number of postings and bytes, followed by
+ *		varints: file delta, offset delta (absolute in a new file)
+ */
+
+# include <stdio.h>
+# include <stdlib.h>
+# include <stdint.h>
+# include <string.h>
+# include <ctype.h>
+# include <fcntl.h>
+# include <unistd.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include "Position.h"
+# include "l_scan.h"
+# include "include.h"
+# include "tokindex.h"
+
+# define TOKINDEX_MAGIC		"ltokidx1"
+# define BLOCK_SIZE		128	/* postings per block */
+# define INIT_TERM_TABLE_SIZE	1024	/* must be a power of 2 */
+
+typedef struct {
+  char		Magic [8];
+  uint32_t	FileCount, TermCount;
+  uint64_t	Files, Terms, Strings, Postings;
+} tHeader;
+
+typedef struct {
+  uint32_t	Name, NameLength;	/* in the string pool */
+} tFileEntry;
+
+typedef struct {
+  uint32_t	Name, NameLength;	/* in the string pool */
+  uint32_t	Count, Blocks;
+  uint64_t	First;			/* offset of the first block */
+} tTermEntry;
+
+typedef struct {
+  uint32_t	Count, Bytes;
+} tBlockHeader;
+
+/* The keywords of the scanner, they are entered in lower case */
+static const char * keywords [] = { "begin", NULL };
+
+/* Returns in `Folded' the lower case of `Name', if it is a keyword */
+static int IsKeyword (const char * Name, int Length, char * Folded)
+{
+  const char ** k;
+  int i;
+  for (k = keywords; * k != NULL; k ++) {
+    if ((int) strlen (* k) != Length) continue;
+    for (i = 0; i < Length && tolower ((unsigned char) Name [i]) == (* k) [i]; i ++);
+    if (i == Length) { memcpy (Folded, * k, Length); return 1; }
+  }
+  return 0;
+}
+
+/*****************************************************************************
+ * building
+ *****************************************************************************/
+
+typedef struct {
+  uint32_t	File;
+  int64_t	Offset;
+} tPosting;
+
+typedef struct {
+  char *	Name;			/* NULL: free slot */
+  int		Length;
+  tPosting *	Postings;
+  uint32_t	Count, Size;
+} tTerm;
+
+static tTerm *	     terms      = NULL;
+static unsigned long term_size  = 0;
+static unsigned long term_count = 0;
+
+static unsigned long Hash (const char * s, int n)
+{
+  unsigned long h = 5381;
+  while (n -- > 0) h = h * 33 + (unsigned char) *s ++;
+  return h;
+}
+
+static tTerm * Lookup (tTerm * table, unsigned long size, const char * Name, int Length)
+{
+  unsigned long i = Hash (Name, Length) & (size - 1);
+  while (table [i].Name != NULL &&
+	 (table [i].Length != Length || memcmp (table [i].Name, Name, Length) != 0))
+    i = (i + 1) & (size - 1);
+  return & table [i];
+}
+
+/* Returns the term `Name', entering it if necessary */
+static tTerm * Intern (const char * Name, int Length)
+{
+  tTerm * t;
+  if (2 * (term_count + 1) > term_size) {		/* keep load <= 1/2 */
+    unsigned long new_size = term_size == 0 ? INIT_TERM_TABLE_SIZE : 2 * term_size;
+    tTerm * new_terms = calloc (new_size, sizeof (tTerm));
+    unsigned long i;
+    if (new_terms == NULL) return NULL;
+    for (i = 0; i < term_size; i ++)
+      if (terms [i].Name != NULL)
+	* Lookup (new_terms, new_size, terms [i].Name, terms [i].Length) = terms [i];
+    free (terms);
+    terms = new_terms;
+    term_size = new_size;
+  }
+  t = Lookup (terms, term_size, Name, Length);
+  if (t->Name == NULL) {
+    if ((t->Name = malloc (Length)) == NULL) return NULL;
+    memcpy (t->Name, Name, Length);
+    t->Length = Length;
+    term_count ++;
+  }
+  return t;
+}
+
+static int AddPosting (tTerm * t, uint32_t File, int64_t Offset)
+{
+  if (t->Count == t->Size) {
+    uint32_t size = t->Size == 0 ? 4 : 2 * t->Size;
+    tPosting * p = realloc (t->Postings, size * sizeof (tPosting));
+    if (p == NULL) return 0;
+    t->Postings = p;
+    t->Size = size;
+  }
+  t->Postings [t->Count].File   = File;
+  t->Postings [t->Count].Offset = Offset;
+  t->Count ++;
+  return 1;
+}
+
+static void ReleaseTerms (void)
+{
+  unsigned long i;
+  for (i = 0; i < term_size; i ++) {
+    free (terms [i].Name);
+    free (terms [i].Postings);
+  }
+  free (terms);
+  terms = NULL;
+  term_size = term_count = 0;
+}
+
+static int ByName (const void * a, const void * b)
+{
+  const tTerm * t1 = * (tTerm * const *) a, * t2 = * (tTerm * const *) b;
+  int n = t1->Length < t2->Length ? t1->Length : t2->Length;
+  int c = memcmp (t1->Name, t2->Name, n);
+  return c != 0 ? c : t1->Length - t2->Length;
+}
+
+static int PutVarint (unsigned char * p, uint64_t v)
+{
+  int n = 0;
+  while (v >= 0x80) { p [n ++] = (unsigned char) (v | 0x80); v >>= 7; }
+  p [n ++] = (unsigned char) v;
+  return n;
+}
+
+/* Encodes the postings `First' .. of `t' (at most BLOCK_SIZE) into `Buffer',
+ * returns the number of bytes
+ */
+static int EncodeBlock (tTerm * t, uint32_t First, unsigned char * Buffer)
+{
+  uint32_t n, end = First + BLOCK_SIZE < t->Count ? First + BLOCK_SIZE : t->Count;
+  int bytes = 0;
+  for (n = First; n < end; n ++) {
+    tPosting * p = & t->Postings [n];
+    if (n == First) {
+      bytes += PutVarint (Buffer + bytes, p->File);
+      bytes += PutVarint (Buffer + bytes, p->Offset);
+    } else {
+      bytes += PutVarint (Buffer + bytes, p->File - p [-1].File);
+      bytes += PutVarint (Buffer + bytes, p->File != p [-1].File ? p->Offset
+						 : p->Offset - p [-1].Offset);
+    }
+  }
+  return bytes;
+}
+
+/* Scans one file and enters its identifiers and keywords */
+static int IndexFile (char * FileName, uint32_t File)
+{
+  int Token;
+  char keyword [16];
+  l_scan_BeginFile (FileName);
+  while ((Token = l_scan_GetToken ()) != l_scan_EofToken) {
+    tTerm * t;
+    if (Token == tok_identifier_const) {
+      t = Intern (l_scan_Attribute.identifier_const.Value.Ptr,
+		  l_scan_Attribute.identifier_const.Value.Length);
+    } else if (Token == tok_begin_const && l_scan_TokenLength < (int) sizeof (keyword) &&
+	       IsKeyword (l_scan_TokenPtr, l_scan_TokenLength, keyword)) {
+      t = Intern (keyword, l_scan_TokenLength);
+    } else {
+      continue;
+    }
+    if (t == NULL || ! AddPosting (t, File, l_scan_TokenOffset)) return 0;
+  }
+  return 1;
+}
+
+int BuildTokenIndex (char * IndexName, int FileCount, char ** FileNames)
+{
+  FILE *	f;
+  tHeader	header;
+  tTerm **	sorted;
+  uint64_t	strings = 0, postings = 0;
+  static unsigned char buffer [BLOCK_SIZE * 20];	/* 2 varints of <= 10 bytes */
+  unsigned long	i, k;
+  int		ok = 1;
+
+  for (i = 0; i < (unsigned long) FileCount && ok; i ++)
+    ok = IndexFile (FileNames [i], (uint32_t) i);
+  ReleaseIncludes ();			/* the terms are copies */
+  if (! ok || (f = fopen (IndexName, "wb")) == NULL) { ReleaseTerms (); return 0; }
+
+  sorted = malloc ((term_count + 1) * sizeof (tTerm *));
+  if (sorted == NULL) { fclose (f); ReleaseTerms (); return 0; }
+  for (i = k = 0; i < term_size; i ++)
+    if (terms [i].Name != NULL) sorted [k ++] = & terms [i];
+  qsort (sorted, term_count, sizeof (tTerm *), ByName);
+
+  memset (& header, 0, sizeof (header));
+  memcpy (header.Magic, TOKINDEX_MAGIC, sizeof (header.Magic));
+  header.FileCount = (uint32_t) FileCount;
+  header.TermCount = (uint32_t) term_count;
+  header.Files	   = sizeof (header);
+  header.Terms	   = header.Files + FileCount * sizeof (tFileEntry);
+  header.Strings   = header.Terms + term_count * sizeof (tTermEntry);
+  for (i = 0; i < (unsigned long) FileCount; i ++) strings += strlen (FileNames [i]);
+  for (i = 0; i < term_count; i ++) strings += sorted [i]->Length;
+  header.Postings  = header.Strings + strings;
+  fwrite (& header, sizeof (header), 1, f);
+
+  /* files */
+  for (i = 0, strings = 0; i < (unsigned long) FileCount; i ++) {
+    tFileEntry e;
+    e.Name	 = (uint32_t) strings;
+    e.NameLength = (uint32_t) strlen (FileNames [i]);
+    fwrite (& e, sizeof (e), 1, f);
+    strings += e.NameLength;
+  }
+  /* terms: the blocks are written in the same order below */
+  for (i = 0; i < term_count; i ++) {
+    tTermEntry e;
+    tTerm * t = sorted [i];
+    uint32_t j;
+    e.Name	 = (uint32_t) strings;
+    e.NameLength = (uint32_t) t->Length;
+    e.Count	 = t->Count;
+    e.Blocks	 = (t->Count + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    e.First	 = header.Postings + postings;
+    strings += t->Length;
+    for (j = 0; j < t->Count; j += BLOCK_SIZE)		/* size of the blocks */
+      postings += sizeof (tBlockHeader) + EncodeBlock (t, j, buffer);
+    fwrite (& e, sizeof (e), 1, f);
+  }
+  /* strings */
+  for (i = 0; i < (unsigned long) FileCount; i ++)
+    fwrite (FileNames [i], 1, strlen (FileNames [i]), f);
+  for (i = 0; i < term_count; i ++)
+    fwrite (sorted [i]->Name, 1, sorted [i]->Length, f);
+  /* postings */
+  for (i = 0; i < term_count; i ++) {
+    tTerm * t = sorted [i];
+    uint32_t j;
+    for (j = 0; j < t->Count; j += BLOCK_SIZE) {
+      tBlockHeader b;
+      b.Bytes = (uint32_t) EncodeBlock (t, j, buffer);
+      b.Count = t->Count - j < BLOCK_SIZE ? t->Count - j : BLOCK_SIZE;
+      fwrite (& b, sizeof (b), 1, f);
+      fwrite (buffer, 1, b.Bytes, f);
+    }
+  }
+  ok = ferror (f) == 0;
+  ok &= fclose (f) == 0;
+  free (sorted);
+  ReleaseTerms ();
+  return ok;
+}
+
+/*****************************************************************************
+ * querying
+ *****************************************************************************/
+
+/* Reads a varint at `*p' in front of `End', returns 0 if it does not fit */
+static int GetVarint (const unsigned char ** p, const unsigned char * End, uint64_t * v)
+{
+  int shift = 0;
+  * v = 0;
+  for (; * p < End && shift < 64; shift += 7) {
+    unsigned char c = * (* p) ++;
+    * v |= (uint64_t) (c & 0x7f) << shift;
+    if ((c & 0x80) == 0) return 1;
+  }
+  return 0;
+}
+
+/* Checks that the `Count' entries of `Size' bytes at `Offset' are within
+ * the `Length' bytes of the index
+ */
+static int Within (uint64_t Offset, uint64_t Count, uint64_t Size, uint64_t Length)
+{
+  return Offset <= Length && Count <= (Length - Offset) / Size;
+}
+
+long QueryTokenIndex (char * IndexName, char * Term, FILE * Out)
+{
+  int		 fd = open (IndexName, O_RDONLY);
+  struct stat	 st;
+  unsigned char * map;
+  const unsigned char * end;
+  const tHeader * header;
+  const tTermEntry * e;
+  const tFileEntry * files;
+  const char *	 strings;
+  uint64_t	 size, string_size;
+  long		 low, high, count = -1;
+  int		 length = (int) strlen (Term);
+  char		 keyword [16];
+
+  if (fd < 0) return -1;
+  if (fstat (fd, & st) != 0 || st.st_size < (off_t) sizeof (tHeader)) { close (fd); return -1; }
+  map = mmap (NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close (fd);
+  if (map == MAP_FAILED) return -1;
+  size = (uint64_t) st.st_size;
+  end  = map + size;
+  header = (const tHeader *) map;
+  if (memcmp (header->Magic, TOKINDEX_MAGIC, sizeof (header->Magic)) != 0 ||
+      ! Within (header->Files, header->FileCount, sizeof (tFileEntry), size) ||
+      ! Within (header->Terms, header->TermCount, sizeof (tTermEntry), size) ||
+      header->Strings > header->Postings || header->Postings > size)
+    goto done;
+  files	      = (const tFileEntry *) (map + header->Files);
+  strings     = (const char *) map + header->Strings;
+  string_size = header->Postings - header->Strings;
+  e	      = (const tTermEntry *) (map + header->Terms);
+  if (length < (int) sizeof (keyword) && IsKeyword (Term, length, keyword))
+    Term = keyword;			/* keywords are entered in lower case */
+
+  /* binary search for the term */
+  count = 0;
+  low = 0;
+  high = (long) header->TermCount - 1;
+  while (low <= high) {
+    long mid = low + (high - low) / 2;
+    int n, c;
+    if (! Within (e [mid].Name, e [mid].NameLength, 1, string_size)) { count = -1; goto done; }
+    n = (int) e [mid].NameLength < length ? (int) e [mid].NameLength : length;
+    c = memcmp (strings + e [mid].Name, Term, n);
+    if (c == 0) c = (int) e [mid].NameLength - length;
+    if (c < 0) low = mid + 1;
+    else if (c > 0) high = mid - 1;
+    else {
+      const unsigned char * p;
+      uint32_t block, file = 0;
+      int64_t offset = 0;
+      if (e [mid].First < header->Postings || e [mid].First > size) { count = -1; goto done; }
+      p = map + e [mid].First;
+      for (block = 0; block < e [mid].Blocks; block ++) {
+	tBlockHeader b;
+	const unsigned char * block_end;
+	uint32_t n;
+	if ((uint64_t) (end - p) < sizeof (b)) { count = -1; goto done; }
+	memcpy (& b, p, sizeof (b));
+	p += sizeof (b);
+	if ((uint64_t) (end - p) < b.Bytes) { count = -1; goto done; }
+	block_end = p + b.Bytes;
+	for (n = 0; n < b.Count; n ++) {
+	  uint64_t file_delta, offset_value;
+	  if (! GetVarint (& p, block_end, & file_delta) ||
+	      ! GetVarint (& p, block_end, & offset_value)) { count = -1; goto done; }
+	  if (n == 0) file = (uint32_t) file_delta; else file += (uint32_t) file_delta;
+	  if (n == 0 || file_delta != 0) offset = (int64_t) offset_value;
+	  else offset += (int64_t) offset_value;
+	  if (file >= header->FileCount ||
+	      ! Within (files [file].Name, files [file].NameLength, 1, string_size)) {
+	    count = -1;
+	    goto done;
+	  }
+	  fprintf (Out, "%.*s %lld\n", (int) files [file].NameLength,
+		   strings + files [file].Name, (long long) offset);
+	  count ++;
+	}
+      }
+      break;
+    }
+  }
+done:
+  munmap (map, st.st_size);
+  return count;
+}
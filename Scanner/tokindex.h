@@ -0,0 +1,27 @@
+/* Project:  COCKTAIL training
+ * Descr:    a simple scanner generated with rex
+ * Kind:     inverted index of identifiers and keywords (interface)
+ */
+
+# ifndef tokindex_H
+# define tokindex_H
+
+# include <stdio.h>
+
+extern int BuildTokenIndex (char * IndexName, int FileCount, char ** FileNames);
+/* Scans the files `FileNames [0 .. FileCount-1]' and writes the index file
+ * `IndexName': for every identifier and keyword (keywords in lower case)
+ * the list of its occurrences (file, offset), delta encoded in blocks.
+ * The files mapped into memory for scanning are released (ReleaseIncludes).
+ * Returns 0, if the index can not be written, 1 otherwise.
+ */
+
+extern long QueryTokenIndex (char * IndexName, char * Term, FILE * Out);
+/* Writes the occurrences of `Term' as lines "file offset" to `Out'. The
+ * index is mapped into memory and searched, the files are not scanned.
+ * A keyword is found in any case, like the scanner finds it.
+ * Returns the number of occurrences, -1 if the index can not be read or
+ * is corrupt.
+ */
+
+# endif